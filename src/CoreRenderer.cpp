@@ -0,0 +1,340 @@
+#include "CoreRenderer.h"
+#include <GL/freeglut.h> // Para glutGetProcAddress
+#include <GL/glext.h>    // Tipos das funções do OpenGL 3.3 (PFNGL...PROC)
+#include <stdio.h>       // Para printf, fprintf, sscanf
+#include <stdlib.h>      // Para malloc, free
+#include <string.h>      // Para memset, memcpy
+
+// Funções do OpenGL além da versão 1.1, que os cabeçalhos do sistema nem sempre declaram
+// (no Windows, por exemplo). São carregadas em coreRendererInit.
+#define CORE_GL_FUNCTIONS(X) \
+    X(PFNGLGENBUFFERSPROC, GenBuffers) \
+    X(PFNGLDELETEBUFFERSPROC, DeleteBuffers) \
+    X(PFNGLBINDBUFFERPROC, BindBuffer) \
+    X(PFNGLBUFFERDATAPROC, BufferData) \
+    X(PFNGLMAPBUFFERRANGEPROC, MapBufferRange) \
+    X(PFNGLUNMAPBUFFERPROC, UnmapBuffer) \
+    X(PFNGLGENVERTEXARRAYSPROC, GenVertexArrays) \
+    X(PFNGLDELETEVERTEXARRAYSPROC, DeleteVertexArrays) \
+    X(PFNGLBINDVERTEXARRAYPROC, BindVertexArray) \
+    X(PFNGLVERTEXATTRIBPOINTERPROC, VertexAttribPointer) \
+    X(PFNGLENABLEVERTEXATTRIBARRAYPROC, EnableVertexAttribArray) \
+    X(PFNGLDRAWELEMENTSBASEVERTEXPROC, DrawElementsBaseVertex) \
+    X(PFNGLDRAWARRAYSINSTANCEDPROC, DrawArraysInstanced) \
+    X(PFNGLVERTEXATTRIBDIVISORPROC, VertexAttribDivisor) \
+    X(PFNGLCREATESHADERPROC, CreateShader) \
+    X(PFNGLDELETESHADERPROC, DeleteShader) \
+    X(PFNGLSHADERSOURCEPROC, ShaderSource) \
+    X(PFNGLCOMPILESHADERPROC, CompileShader) \
+    X(PFNGLGETSHADERIVPROC, GetShaderiv) \
+    X(PFNGLGETSHADERINFOLOGPROC, GetShaderInfoLog) \
+    X(PFNGLCREATEPROGRAMPROC, CreateProgram) \
+    X(PFNGLDELETEPROGRAMPROC, DeleteProgram) \
+    X(PFNGLATTACHSHADERPROC, AttachShader) \
+    X(PFNGLBINDATTRIBLOCATIONPROC, BindAttribLocation) \
+    X(PFNGLLINKPROGRAMPROC, LinkProgram) \
+    X(PFNGLGETPROGRAMIVPROC, GetProgramiv) \
+    X(PFNGLGETPROGRAMINFOLOGPROC, GetProgramInfoLog) \
+    X(PFNGLUSEPROGRAMPROC, UseProgram) \
+    X(PFNGLGETUNIFORMLOCATIONPROC, GetUniformLocation) \
+    X(PFNGLUNIFORM1IPROC, Uniform1i) \
+    X(PFNGLUNIFORMMATRIX4FVPROC, UniformMatrix4fv)
+
+#define DECLARE_GL_FUNCTION(type, name) type name;
+static struct {
+    CORE_GL_FUNCTIONS(DECLARE_GL_FUNCTION)
+} gl;
+
+// Bytes de um sprite no anel: 4 vértices com x, y, u, v.
+#define SPRITE_BYTES (16 * (int)sizeof(float))
+
+static const char* SPRITE_VERTEX_SHADER =
+    "#version 330 core\n"
+    "layout(location = 0) in vec2 position;\n"
+    "layout(location = 1) in vec2 texCoord;\n"
+    "uniform mat4 transform;\n"
+    "out vec2 uv;\n"
+    "void main() {\n"
+    "    uv = texCoord;\n"
+    "    gl_Position = transform * vec4(position, 0.0, 1.0);\n"
+    "}\n";
+
+// Caminho instanciado: cada instância é um retângulo e a sua região da textura. O canto do
+// retângulo sai do número do vértice (0..3, desenhados como GL_TRIANGLE_STRIP).
+static const char* INSTANCE_VERTEX_SHADER =
+    "#version 330 core\n"
+    "layout(location = 0) in vec4 rect;\n"
+    "layout(location = 1) in vec4 uvRect;\n"
+    "uniform mat4 transform;\n"
+    "out vec2 uv;\n"
+    "void main() {\n"
+    "    vec2 corner = vec2(gl_VertexID & 1, gl_VertexID >> 1);\n"
+    "    uv = mix(uvRect.xy, uvRect.zw, corner);\n"
+    "    gl_Position = transform * vec4(rect.xy + rect.zw * corner, 0.0, 1.0);\n"
+    "}\n";
+
+static const char* SPRITE_FRAGMENT_SHADER =
+    "#version 330 core\n"
+    "in vec2 uv;\n"
+    "uniform sampler2D spriteTexture;\n"
+    "out vec4 color;\n"
+    "void main() {\n"
+    "    color = texture(spriteTexture, uv);\n"
+    "}\n";
+
+static int loadFunctions() {
+    int ok = 1;
+#define LOAD_GL_FUNCTION(type, name) \
+    gl.name = (type)glutGetProcAddress("gl" #name); \
+    if (!gl.name) { fprintf(stderr, "OpenGL 3.3: funcao gl%s indisponivel.\n", #name); ok = 0; }
+    CORE_GL_FUNCTIONS(LOAD_GL_FUNCTION)
+#undef LOAD_GL_FUNCTION
+    return ok;
+}
+
+static GLuint compileShader(GLenum type, const char* source) {
+    GLuint shader = gl.CreateShader(type);
+    gl.ShaderSource(shader, 1, &source, NULL);
+    gl.CompileShader(shader);
+    GLint compiled = 0;
+    gl.GetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+    if (!compiled) {
+        char log[1024];
+        gl.GetShaderInfoLog(shader, sizeof(log), NULL, log);
+        fprintf(stderr, "OpenGL 3.3: erro ao compilar o shader: %s\n", log);
+        gl.DeleteShader(shader);
+        return 0;
+    }
+    return shader;
+}
+
+static GLuint linkSpriteProgram(const char* vertexSource) {
+    GLuint vertexShader = compileShader(GL_VERTEX_SHADER, vertexSource);
+    GLuint fragmentShader = compileShader(GL_FRAGMENT_SHADER, SPRITE_FRAGMENT_SHADER);
+    if (!vertexShader || !fragmentShader) return 0;
+
+    GLuint program = gl.CreateProgram();
+    gl.AttachShader(program, vertexShader);
+    gl.AttachShader(program, fragmentShader);
+    gl.LinkProgram(program);
+    // Depois de ligados ao programa, os shaders podem ser descartados.
+    gl.DeleteShader(vertexShader);
+    gl.DeleteShader(fragmentShader);
+    GLint linked = 0;
+    gl.GetProgramiv(program, GL_LINK_STATUS, &linked);
+    if (!linked) {
+        char log[1024];
+        gl.GetProgramInfoLog(program, sizeof(log), NULL, log);
+        fprintf(stderr, "OpenGL 3.3: erro ao ligar o shader: %s\n", log);
+        gl.DeleteProgram(program);
+        return 0;
+    }
+    return program;
+}
+
+/**
+ * Garante que o buffer de índices cubra 'spriteCount' sprites. Os índices não dependem do quadro
+ * (sprite i usa os vértices 4i..4i+3), então só são reescritos quando um quadro tem mais sprites.
+ */
+static void ensureIndices(CoreRenderer_s* renderer, int spriteCount) {
+    if (spriteCount <= renderer->indexedSprites) return;
+    int count = renderer->indexedSprites ? renderer->indexedSprites : 1024;
+    while (count < spriteCount) count *= 2;
+    GLuint* indices = (GLuint*)malloc(sizeof(GLuint) * 6 * count);
+    for (int i = 0; i < count; i++) {
+        GLuint v = (GLuint)i * 4;
+        indices[i * 6 + 0] = v;
+        indices[i * 6 + 1] = v + 1;
+        indices[i * 6 + 2] = v + 2;
+        indices[i * 6 + 3] = v + 2;
+        indices[i * 6 + 4] = v + 3;
+        indices[i * 6 + 5] = v;
+    }
+    // O buffer de índices faz parte do estado do VAO, que já está ligado.
+    gl.BufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLuint) * 6 * count, indices, GL_STATIC_DRAW);
+    free(indices);
+    renderer->indexedSprites = count;
+}
+
+/**
+ * Cria o buffer do anel (ligado em GL_ARRAY_BUFFER ao voltar).
+ */
+static void initRing(StreamRing_s* ring) {
+    gl.GenBuffers(1, &ring->buffer);
+    gl.BindBuffer(GL_ARRAY_BUFFER, ring->buffer);
+    ring->bytes = CORE_STREAM_BUFFER_BYTES;
+    ring->offset = 0;
+    gl.BufferData(GL_ARRAY_BUFFER, ring->bytes, NULL, GL_STREAM_DRAW);
+}
+
+/**
+ * Mapeia 'bytes' a partir de ring->offset (o anel precisa estar ligado em GL_ARRAY_BUFFER).
+ * Se não couberem até o fim do anel, o buffer é renovado (e cresce, se for pequeno demais).
+ * Quem chama avança ring->offset com o que realmente escreveu.
+ */
+static void* mapRing(StreamRing_s* ring, int bytes) {
+    if (ring->offset + bytes > ring->bytes) {
+        // Anel cheio: pede um armazenamento novo ao driver (o antigo é liberado quando a GPU terminar).
+        while (bytes > ring->bytes) ring->bytes *= 2;
+        gl.BufferData(GL_ARRAY_BUFFER, ring->bytes, NULL, GL_STREAM_DRAW);
+        ring->offset = 0;
+        ring->orphans++;
+    }
+    if (bytes == 0) return NULL;
+    return gl.MapBufferRange(GL_ARRAY_BUFFER, ring->offset, bytes,
+                             GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+}
+
+int coreRendererInit(CoreRenderer_s* renderer) {
+    memset(renderer, 0, sizeof(*renderer));
+
+    int major = 0, minor = 0;
+    const char* version = (const char*)glGetString(GL_VERSION);
+    if (!version || sscanf(version, "%d.%d", &major, &minor) != 2 || major * 10 + minor < 33) {
+        fprintf(stderr, "OpenGL 3.3: o contexto criado e %s.\n", version ? version : "desconhecido");
+        return 0;
+    }
+    if (!loadFunctions()) return 0;
+
+    renderer->program = linkSpriteProgram(SPRITE_VERTEX_SHADER);
+    renderer->instanceProgram = linkSpriteProgram(INSTANCE_VERTEX_SHADER);
+    if (!renderer->program || !renderer->instanceProgram) return 0;
+    renderer->transformLocation = gl.GetUniformLocation(renderer->program, "transform");
+    renderer->instanceTransformLocation = gl.GetUniformLocation(renderer->instanceProgram, "transform");
+    gl.UseProgram(renderer->program);
+    gl.Uniform1i(gl.GetUniformLocation(renderer->program, "spriteTexture"), 0);
+    gl.UseProgram(renderer->instanceProgram);
+    gl.Uniform1i(gl.GetUniformLocation(renderer->instanceProgram, "spriteTexture"), 0);
+    gl.UseProgram(0);
+
+    // Lote: 4 vértices por sprite e um buffer de índices.
+    gl.GenVertexArrays(1, &renderer->vao);
+    gl.GenBuffers(1, &renderer->ebo);
+    gl.BindVertexArray(renderer->vao);
+    initRing(&renderer->vertices);
+    gl.VertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (const void*)0);
+    gl.VertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (const void*)(2 * sizeof(float)));
+    gl.EnableVertexAttribArray(0);
+    gl.EnableVertexAttribArray(1);
+    gl.BindBuffer(GL_ELEMENT_ARRAY_BUFFER, renderer->ebo);
+    ensureIndices(renderer, 1);
+
+    // Instâncias: os dois atributos avançam uma vez por instância. Os ponteiros são definidos a cada
+    // sequência em coreRendererEndInstances, pois o 3.3 não tem "primeira instância" no desenho.
+    gl.GenVertexArrays(1, &renderer->instanceVao);
+    gl.BindVertexArray(renderer->instanceVao);
+    initRing(&renderer->instances);
+    gl.EnableVertexAttribArray(0);
+    gl.EnableVertexAttribArray(1);
+    gl.VertexAttribDivisor(0, 1);
+    gl.VertexAttribDivisor(1, 1);
+    gl.BindVertexArray(0);
+    gl.BindBuffer(GL_ARRAY_BUFFER, 0);
+
+    coreRendererSetTransform(renderer, 1.0f, 1.0f, 1.0f, 0.0f, 0.0f);
+    printf("Caminho de desenho OpenGL 3.3 ativo (%s, %s).\n", version, (const char*)glGetString(GL_RENDERER));
+    return 1;
+}
+
+void coreRendererSetTransform(CoreRenderer_s* renderer, float viewWidth, float viewHeight, float scale, float cameraX, float cameraY) {
+    // Mesmo resultado de gluOrtho2D(0, w, 0, h) seguido de glScalef(scale) e glTranslatef(-cameraX, -cameraY).
+    float* m = renderer->transform;
+    memset(m, 0, sizeof(renderer->transform));
+    m[0] = 2.0f * scale / viewWidth;
+    m[5] = 2.0f * scale / viewHeight;
+    m[10] = -1.0f;
+    m[12] = -2.0f * scale * cameraX / viewWidth - 1.0f;
+    m[13] = -2.0f * scale * cameraY / viewHeight - 1.0f;
+    m[15] = 1.0f;
+}
+
+int coreRendererBegin(CoreRenderer_s* renderer, const float* vertices, int spriteCount) {
+    int bytes = spriteCount * SPRITE_BYTES;
+    gl.UseProgram(renderer->program);
+    gl.UniformMatrix4fv(renderer->transformLocation, 1, GL_FALSE, renderer->transform);
+    gl.BindVertexArray(renderer->vao);
+    gl.BindBuffer(GL_ARRAY_BUFFER, renderer->vertices.buffer);
+    ensureIndices(renderer, spriteCount);
+
+    void* target = mapRing(&renderer->vertices, bytes);
+    if (target) {
+        memcpy(target, vertices, bytes);
+        gl.UnmapBuffer(GL_ARRAY_BUFFER);
+    }
+    // Cada sprite ocupa SPRITE_BYTES, então o deslocamento sempre cai no início de um vértice.
+    int baseVertex = renderer->vertices.offset / (4 * (int)sizeof(float));
+    renderer->vertices.offset += bytes;
+    return baseVertex;
+}
+
+void coreRendererDrawRun(GLuint texture, int baseVertex, int firstSprite, int spriteCount) {
+    glBindTexture(GL_TEXTURE_2D, texture);
+    gl.DrawElementsBaseVertex(GL_TRIANGLES, spriteCount * 6, GL_UNSIGNED_INT,
+                              (const void*)((size_t)firstSprite * 6 * sizeof(GLuint)), baseVertex);
+}
+
+void coreRendererEnd() {
+    gl.BindVertexArray(0);
+    gl.BindBuffer(GL_ARRAY_BUFFER, 0);
+    gl.UseProgram(0);
+}
+
+void coreRendererBeginInstances(CoreRenderer_s* renderer, int maxInstances) {
+    gl.BindBuffer(GL_ARRAY_BUFFER, renderer->instances.buffer);
+    renderer->mapped = (SpriteInstance_s*)mapRing(&renderer->instances, maxInstances * (int)sizeof(SpriteInstance_s));
+    gl.BindBuffer(GL_ARRAY_BUFFER, 0);
+    // Sem mapeamento, coreRendererAddInstance não escreve nada.
+    renderer->instanceCapacity = renderer->mapped ? maxInstances : 0;
+    renderer->instanceCount = 0;
+    renderer->instanceBase = renderer->instances.offset / (int)sizeof(SpriteInstance_s);
+    renderer->runCount = 0;
+}
+
+void coreRendererStartRun(CoreRenderer_s* renderer, GLuint texture) {
+    if (renderer->runCount == renderer->runCapacity) {
+        renderer->runCapacity = renderer->runCapacity ? renderer->runCapacity * 2 : 16;
+        renderer->runs = (InstanceRun_s*)realloc(renderer->runs, sizeof(InstanceRun_s) * renderer->runCapacity);
+    }
+    InstanceRun_s* run = &renderer->runs[renderer->runCount++];
+    run->texture = texture;
+    run->first = renderer->instanceCount;
+    run->count = 0;
+}
+
+void coreRendererEndInstances(CoreRenderer_s* renderer) {
+    renderer->lastInstanceDraws = 0;
+    if (!renderer->mapped) return;
+    gl.BindBuffer(GL_ARRAY_BUFFER, renderer->instances.buffer);
+    gl.UnmapBuffer(GL_ARRAY_BUFFER);
+    renderer->mapped = NULL;
+
+    gl.UseProgram(renderer->instanceProgram);
+    gl.UniformMatrix4fv(renderer->instanceTransformLocation, 1, GL_FALSE, renderer->transform);
+    gl.BindVertexArray(renderer->instanceVao);
+    for (int r = 0; r < renderer->runCount; r++) {
+        const InstanceRun_s* run = &renderer->runs[r];
+        size_t offset = (size_t)(renderer->instanceBase + run->first) * sizeof(SpriteInstance_s);
+        gl.VertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, sizeof(SpriteInstance_s), (const void*)offset);
+        gl.VertexAttribPointer(1, 4, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(SpriteInstance_s), (const void*)(offset + 4 * sizeof(float)));
+        glBindTexture(GL_TEXTURE_2D, run->texture);
+        gl.DrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, run->count);
+    }
+    renderer->lastInstanceDraws = renderer->runCount;
+    // Só o que foi escrito ocupa o anel; o resto do trecho mapeado fica para o próximo quadro.
+    renderer->instances.offset += renderer->instanceCount * (int)sizeof(SpriteInstance_s);
+    gl.BindVertexArray(0);
+    gl.BindBuffer(GL_ARRAY_BUFFER, 0);
+    gl.UseProgram(0);
+}
+
+void coreRendererFree(CoreRenderer_s* renderer) {
+    if (renderer->program) gl.DeleteProgram(renderer->program);
+    if (renderer->instanceProgram) gl.DeleteProgram(renderer->instanceProgram);
+    if (renderer->vertices.buffer) gl.DeleteBuffers(1, &renderer->vertices.buffer);
+    if (renderer->instances.buffer) gl.DeleteBuffers(1, &renderer->instances.buffer);
+    if (renderer->ebo) gl.DeleteBuffers(1, &renderer->ebo);
+    if (renderer->vao) gl.DeleteVertexArrays(1, &renderer->vao);
+    if (renderer->instanceVao) gl.DeleteVertexArrays(1, &renderer->instanceVao);
+    free(renderer->runs);
+    memset(renderer, 0, sizeof(*renderer));
+}
@@ -0,0 +1,109 @@
+#ifndef CORERENDERER_H
+#define CORERENDERER_H
+
+#include <GL/glut.h> // Para GLuint
+
+// --- Caminho de Desenho OpenGL 3.3 (shaders e VBOs) ---
+// Alternativa ao pipeline fixo para os sprites da cena: os vértices do lote (SpriteBatch.h) vão
+// para um VBO de streaming criado uma única vez, um shader aplica a textura e a câmera/escala
+// chegam como uma matriz uniforme (em vez de glPushMatrix/glScalef/glTranslatef).
+// Só usa funções do perfil core 3.3, carregadas com glutGetProcAddress.
+//
+// O VBO é um anel: cada quadro escreve logo depois do anterior (glMapBufferRange sem sincronizar,
+// pois a GPU ainda pode estar lendo o trecho antigo); quando o anel enche, o buffer é "órfão"
+// (glBufferData com NULL) e a escrita recomeça do início em um armazenamento novo.
+//
+// Há também um caminho instanciado: cada sprite é um único registro (SpriteInstance_s) escrito
+// direto no anel de instâncias, e o shader expande o registro em um retângulo. Não há ordenação:
+// os sprites são desenhados na ordem em que foram escritos.
+
+#define CORE_STREAM_BUFFER_BYTES (4 * 1024 * 1024) // Tamanho inicial de cada anel.
+
+// Um sprite do caminho instanciado (24 bytes, contra 64 dos 4 vértices do lote).
+typedef struct {
+    float x, y, width, height;  // Retângulo na tela.
+    unsigned short uv[4];       // Região da textura (u0, v0, u1, v1), de 0 a 65535.
+} SpriteInstance_s;
+
+// Sequência de instâncias seguidas com a mesma textura (uma chamada de desenho).
+typedef struct {
+    GLuint texture;
+    int first, count;
+} InstanceRun_s;
+
+// Um buffer de streaming usado como anel.
+typedef struct {
+    GLuint buffer;
+    int bytes;            // Tamanho do anel.
+    int offset;           // Próximo byte livre.
+    int orphans;          // Quantas vezes o anel foi renovado.
+} StreamRing_s;
+
+typedef struct {
+    GLuint program;       // Shader dos sprites do lote.
+    GLuint vao;           // Formato dos vértices (x, y, u, v) e o buffer de índices.
+    GLuint ebo;           // Índices fixos: dois triângulos por sprite (0,1,2 e 2,3,0).
+    GLint transformLocation;
+    float transform[16];  // Matriz da cena (coluna a coluna), enviada ao shader em coreRendererBegin.
+    StreamRing_s vertices;  // Anel com os vértices do lote.
+    int indexedSprites;   // Quantos sprites o buffer de índices cobre.
+
+    // Caminho instanciado.
+    GLuint instanceProgram;
+    GLuint instanceVao;
+    GLint instanceTransformLocation;
+    StreamRing_s instances;       // Anel com os registros das instâncias.
+    SpriteInstance_s* mapped;     // Trecho do anel mapeado entre Begin e EndInstances.
+    int instanceCount;            // Instâncias escritas no quadro.
+    int instanceCapacity;         // Máximo pedido em coreRendererBeginInstances.
+    int instanceBase;             // Índice (no anel) da primeira instância do quadro.
+    InstanceRun_s* runs;
+    int runCount, runCapacity;
+    int lastInstanceDraws;        // Chamadas de desenho do último quadro instanciado.
+} CoreRenderer_s;
+
+// Carrega as funções do OpenGL 3.3, compila os shaders e cria os buffers.
+// Retorna 0 se o contexto não for 3.3 ou algo falhar (a janela volta para o caminho antigo).
+int coreRendererInit(CoreRenderer_s* renderer);
+// Define a matriz da cena: projeção ortográfica da janela, escala e posição da câmera.
+void coreRendererSetTransform(CoreRenderer_s* renderer, float viewWidth, float viewHeight, float scale, float cameraX, float cameraY);
+// Copia os vértices de 'spriteCount' sprites (16 floats cada) para o anel e prepara o desenho.
+// Retorna o índice do primeiro vértice no anel, usado por coreRendererDrawRun.
+int coreRendererBegin(CoreRenderer_s* renderer, const float* vertices, int spriteCount);
+// Desenha 'spriteCount' sprites a partir do sprite 'firstSprite' do último coreRendererBegin
+// (com o programa, o VAO e o buffer que ele deixou ligados).
+void coreRendererDrawRun(GLuint texture, int baseVertex, int firstSprite, int spriteCount);
+// Desfaz as ligações de coreRendererBegin (para o restante do quadro usar o pipeline fixo).
+void coreRendererEnd();
+
+// Mapeia espaço para até 'maxInstances' instâncias no anel; coreRendererAddInstance escreve nele.
+void coreRendererBeginInstances(CoreRenderer_s* renderer, int maxInstances);
+// Desenha as instâncias escritas desde coreRendererBeginInstances (uma chamada por textura seguida).
+void coreRendererEndInstances(CoreRenderer_s* renderer);
+// Abre uma nova sequência de instâncias com a textura 'texture' (uso interno de coreRendererAddInstance).
+void coreRendererStartRun(CoreRenderer_s* renderer, GLuint texture);
+
+// Escreve uma instância direto no anel mapeado. Fica no cabeçalho para ser expandida nos laços
+// que percorrem os pools de entidades.
+static inline void coreRendererAddInstance(CoreRenderer_s* renderer, GLuint texture, float x, float y, float width, float height,
+                                           const unsigned short uv[4]) {
+    if (renderer->instanceCount == renderer->instanceCapacity) return;
+    if (renderer->runCount == 0 || renderer->runs[renderer->runCount - 1].texture != texture) {
+        coreRendererStartRun(renderer, texture);
+    }
+    SpriteInstance_s* instance = &renderer->mapped[renderer->instanceCount++];
+    instance->x = x;
+    instance->y = y;
+    instance->width = width;
+    instance->height = height;
+    instance->uv[0] = uv[0];
+    instance->uv[1] = uv[1];
+    instance->uv[2] = uv[2];
+    instance->uv[3] = uv[3];
+    renderer->runs[renderer->runCount - 1].count++;
+}
+
+// Libera os shaders e os buffers.
+void coreRendererFree(CoreRenderer_s* renderer);
+
+#endif // CORERENDERER_H
@@ -0,0 +1,128 @@
+#include "GameLoop.h"
+#include "GameLogic.h"
+#include "Globals.h" // Para g_world, o mundo da janela.
+#include "ThrownTrash.h"
+#include "AutoPlayer.h"
+#include "Planner.h"
+#include "Config.h"
+#include <GL/glut.h>
+
+float g_renderAlpha = 1.0f;
+
+// Instante (em milissegundos desde glutInit) da última chamada, e o tempo real
+// acumulado que ainda não foi consumido por passos da simulação.
+static int lastFrameTimeMs = -1;
+static float tickAccumulator = 0.0f;
+// Se a simulação está rodando, e se a janela está visível.
+static int loopRunning = 0;
+static int windowVisible = 1;
+
+// Ritmo dos quadros: um a cada FRAME_INTERVAL_MS (~60 por segundo, a taxa da maioria dos monitores).
+// Sem isso, em drivers sem sincronização vertical (ou no llvmpipe) o laço desenharia milhares de
+// quadros por segundo e ocuparia um núcleo inteiro.
+#define FRAME_INTERVAL_MS (1000.0 / 60.0)
+static double nextFrameMs = 0.0;  // Instante em que o próximo quadro é devido.
+static int timerPending = 0;      // Se já há um glutTimerFunc agendado (o GLUT não permite cancelar).
+
+// Planejador da janela (modo AUTO_PLAY_PLANNER), criado no primeiro uso: 2 ms por passo.
+static Planner_s* windowPlanner() {
+    static Planner_s* planner = NULL;
+    if (!planner) planner = plannerCreate(16, 30, 6, 0.002);
+    return planner;
+}
+
+/**
+ * Um quadro do jogo, chamado pelo timer do laço (frameTimer) a cada FRAME_INTERVAL_MS.
+ * Em vez de confiar que o timer dispare exatamente no horário (o que não acontece em máquinas
+ * carregadas, deixando o jogo lento), medimos o tempo real decorrido e executamos quantos passos
+ * fixos de SIM_TICK_SECONDS couberem nele. A sobra fica no acumulador para o próximo quadro.
+ * A lógica em si está em step() (core/GameLogic.cpp), que não conhece o GLUT.
+ */
+void updateGame() {
+    int now = glutGet(GLUT_ELAPSED_TIME);
+    if (lastFrameTimeMs < 0) lastFrameTimeMs = now;
+    float frameSeconds = (now - lastFrameTimeMs) / 1000.0f;
+    lastFrameTimeMs = now;
+    // Depois de uma travada longa (janela arrastada, depurador...) não tentamos recuperar tudo,
+    // senão a simulação passaria vários segundos "correndo" sem o jogador conseguir reagir.
+    if (frameSeconds > MAX_FRAME_SECONDS) frameSeconds = MAX_FRAME_SECONDS;
+
+    // Com o jogador automático, uma partida perdida recomeça sozinha (testes longos sem ninguém na frente).
+    if (g_autoPlay && g_world.gameState == GAME_OVER) initGame(&g_world);
+
+    if (g_world.gameState == PLAYING) {
+        tickAccumulator += frameSeconds;
+        while (tickAccumulator >= SIM_TICK_SECONDS) {
+            // O bot decide antes de cada passo, no mesmo ponto em que a entrada do teclado já foi aplicada.
+            if (g_autoPlay == AUTO_PLAY_BOT) autoPlayerAct(&g_world);
+            else if (g_autoPlay == AUTO_PLAY_PLANNER) plannerAct(windowPlanner(), &g_world);
+            step(&g_world);
+            tickAccumulator -= SIM_TICK_SECONDS;
+        }
+        g_renderAlpha = tickAccumulator / SIM_TICK_SECONDS;
+        // O lixo arremessado não é movido a cada passo: sua posição é calculada só para o desenho.
+        updateThrownTrashPositions(&g_world);
+    } else {
+        // Fora da partida (menu, pausa, fim de jogo) o tempo não conta, e o desenho usa a posição atual.
+        tickAccumulator = 0.0f;
+        g_renderAlpha = 1.0f;
+    }
+
+    // Informa ao GLUT que a tela precisa ser redesenhada: um desenho por quadro devido.
+    glutPostRedisplay();
+    // Se a partida acabou neste quadro, o laço para depois de desenhar a tela de fim de jogo.
+    refreshGameLoop();
+}
+
+/**
+ * Agenda o próximo quadro. Os horários seguem uma grade fixa (nextFrameMs), então o atraso de um
+ * disparo não se acumula; se o quadro já está atrasado, ele é feito o quanto antes, sem tentar
+ * recuperar os quadros perdidos (o acumulador de passos já cuida do tempo).
+ */
+static void frameTimer(int);
+static void scheduleFrame() {
+    int now = glutGet(GLUT_ELAPSED_TIME);
+    nextFrameMs += FRAME_INTERVAL_MS;
+    if (nextFrameMs < now) nextFrameMs = now;
+    timerPending = 1;
+    glutTimerFunc((unsigned int)(nextFrameMs - now + 0.5), frameTimer, 0);
+}
+
+static void frameTimer(int) {
+    timerPending = 0;
+    if (!loopRunning) return; // O laço parou enquanto o timer esperava.
+    updateGame();
+    if (loopRunning && !timerPending) scheduleFrame();
+}
+
+/**
+ * Liga ou desliga o laço de quadros conforme o estado do jogo. Só há simulação durante a partida
+ * (ou no fim de jogo com o jogador automático, que recomeça sozinho) e com a janela visível.
+ * Nas telas paradas (menu, pausa, fim de jogo) o GLUT fica apenas esperando eventos, e a tela só é
+ * redesenhada por entrada do usuário, redimensionamento ou exposição da janela.
+ */
+void refreshGameLoop() {
+    int simulating = windowVisible &&
+                     (g_world.gameState == PLAYING || (g_autoPlay != AUTO_PLAY_OFF && g_world.gameState == GAME_OVER));
+    if (simulating == loopRunning) return;
+    loopRunning = simulating;
+    if (simulating) {
+        // O tempo parado não conta: o primeiro quadro depois de voltar mede a partir de agora.
+        lastFrameTimeMs = -1;
+        // Um timer ainda pendente (o laço parou e voltou antes dele disparar) continua o laço.
+        if (!timerPending) {
+            nextFrameMs = glutGet(GLUT_ELAPSED_TIME) - FRAME_INTERVAL_MS;
+            scheduleFrame();
+        }
+    }
+    // Ao parar não há o que desligar: o timer pendente vê loopRunning == 0 e não agenda outro.
+}
+
+/**
+ * Callback do GLUT chamado quando a janela é escondida (minimizada) ou volta a aparecer.
+ */
+void windowStatus(int state) {
+    windowVisible = state != GLUT_HIDDEN;
+    refreshGameLoop();
+    if (windowVisible) glutPostRedisplay();
+}
@@ -0,0 +1,15 @@
+#ifndef GAMELOOP_H
+#define GAMELOOP_H
+
+// --- Protótipos de Funções ---
+// Ponte entre o GLUT e o núcleo da simulação (core/GameLogic).
+
+void updateGame();             // Um quadro: avança a simulação em passos fixos e pede um novo desenho.
+void refreshGameLoop();        // Liga o laço de quadros (glutTimerFunc, ~60 Hz) só enquanto há simulação; chamar depois de mudar gameState ou g_autoPlay.
+void windowStatus(int state);  // Callback do GLUT para a janela escondida/visível: para a simulação enquanto ela está escondida.
+
+// Fração (0 a 1) do próximo passo já decorrida no relógio. O Renderer usa esse valor para
+// desenhar os objetos entre a posição do passo anterior e a do passo atual.
+extern float g_renderAlpha;
+
+#endif // GAMELOOP_H
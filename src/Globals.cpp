@@ -1,38 +1,11 @@
 #include "Globals.h"
 
-// Variável que controla o estado geral do jogo (MENU, PLAYING, etc.). Começa no MENU.
-GameState gameState = MENU;
-// A struct que contém todas as informações do jogador (posição, estado de pulo, etc.).
-Player_s player;
-// Arrays que funcionam como "pools" de objetos para todos os elementos do jogo.
-Obstacle_s obstacles[5];
-TrashBin_s trashBins[TRASH_TYPE_COUNT];
-TrashItem_s thrownTrashItems[10];
+// O mundo da janela. É inicializado em main() (initWorld), antes do primeiro callback do GLUT.
+GameWorld_s g_world;
 
-// --- Variáveis de Estado da Partida ---
-int score = 0;      // Pontuação atual do jogador.
-int lives = 3;      // Vidas restantes do jogador.
-int nextLifeScore = 2000; // Pontuação necessária para ganhar a próxima vida extra.
-float currentObstacleSpeed = OBSTACLE_SPEED_BASE; // Velocidade atual dos obstáculos, que aumenta com o tempo.
-float gameTime = 0.0f;    // Contador de tempo de jogo, usado para aumentar a dificuldade.
-
-// --- Variáveis de Controle de Animação ---
-float backgroundOffset1 = 0.0f; // Deslocamento da primeira imagem de fundo para o efeito de parallax.
-float backgroundOffset2 = WINDOW_WIDTH; // Deslocamento da segunda imagem de fundo.
-float playerAnimationTimer = 0.0f; // Timer para controlar a troca de frames da animação de corrida.
-int currentPlayerRunFrame = 0;     // O frame atual da animação de corrida (0 ou 1).
-
-// --- Variáveis para as Texturas ---
-// São variáveis do tipo GLuint que irão armazenar os IDs únicos de cada textura do OpenGL.
-// Elas são inicializadas com 0 e recebem seus valores reais na função loadAllTextures().
-GLuint playerRunTexture1, playerRunTexture2, playerJumpTexture, playerDuckTexture;
-GLuint backgroundTexture;
-GLuint obstacleTextures[OBSTACLE_TYPE_COUNT];
-GLuint trashBinTextures[TRASH_TYPE_COUNT];
-GLuint trashItemTextures[TRASH_TYPE_COUNT];
-
-// Array de strings usado para exibir o nome do lixo selecionado no HUD (Heads-Up Display).
-const char* TRASH_TYPE_NAMES[TRASH_TYPE_COUNT] = {"Papel", "Vidro", "Plastico", "Metal", "Organico"};
+// --- Atlas de Texturas ---
+// Começa vazio (todas as regiões com textura 0) e é montado na função loadAllTextures().
+TextureAtlas_s g_atlas;
 
 // --- DEFINIÇÕES DO MENU E JANELA (DEFINIDAS APENAS UMA VEZ) ---
 // Flag que controla se a tela de controles está visível ou não.
@@ -44,9 +17,17 @@ Button_s backButton = {0, 0, 150, 40};
 Button_s backToMenuButton = {0, 0, 200, 50};
 Button_s exitButton = {0, 0, 200, 50};
 
-// Variáveis que armazenam as dimensões atuais da janela, a posição da câmera e o fator de escala.
-int g_currentWindowWidth = WINDOW_WIDTH;
-int g_currentWindowHeight = WINDOW_HEIGHT;
+// Variáveis que armazenam a posição da câmera e o fator de escala.
 float cameraX = 0.0f;
 float cameraY = 0.0f;
-float g_dynamicScale = 1.0f;
\ No newline at end of file
+float g_dynamicScale = 1.0f;
+// Dimensões da janela. A lógica do jogo recebe a largura pelo mundo (ver setWorldViewWidth).
+int g_currentWindowWidth = WINDOW_WIDTH;
+int g_currentWindowHeight = WINDOW_HEIGHT;
+// O jogador automático começa desligado; a tecla B alterna.
+AutoPlayMode g_autoPlay = AUTO_PLAY_OFF;
+// Contadores de desenho escondidos e sem teste de carga, a menos que pedidos.
+bool g_showRenderStats = false;
+int g_spriteStress = 0;
+// O pipeline fixo é o padrão; --renderer core ou instanced pede um caminho OpenGL 3.3.
+RenderBackend g_renderBackend = RENDER_BACKEND_LEGACY;
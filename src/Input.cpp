@@ -1,7 +1,9 @@
 #include "Input.h"
-#include "Globals.h"   // Para acessar gameState, player e os botões do menu.
-#include "Config.h"    // Para constantes como JUMP_INITIAL_VELOCITY.
+#include "Globals.h"   // Para acessar o mundo da janela (g_world) e os botões do menu.
+#include "Config.h"    // Para os tipos de lixo (PAPER, GLASS...).
 #include "GameLogic.h" // Para chamar funções de lógica de jogo como initGame().
+#include "Player.h"    // Para as ações do jogador (pular, agachar).
+#include "GameLoop.h"  // Para refreshGameLoop, que liga/desliga a simulação conforme o estado.
 #include <GL/glut.h>   // Para constantes do GLUT como GLUT_KEY_UP e funções como exit().
 #include <stdio.h>     // Para a função printf (usada para depuração).
 #include <stdlib.h>    // Para a função exit().
@@ -28,6 +30,8 @@ bool isClickInside(int mouseX, int mouseY, Button_s button) {
  * y A coordenada Y do mouse no momento do clique.
  */
 void keyboard(unsigned char key, int x, int y) {
+    // Se a tecla mudou algo que aparece na tela. Durante a partida a tela já é redesenhada a cada quadro.
+    bool redraw = false;
     // Um switch para lidar com diferentes teclas.
     switch (key) {
         case 27: // Tecla ESC (código ASCII 27).
@@ -35,30 +39,37 @@ void keyboard(unsigned char key, int x, int y) {
             break;
         case ' ': // Barra de espaço.
             // A ação da barra de espaço só funciona na tela de Game Over.
-            if (gameState == GAME_OVER) {
-                initGame(); // Reinicia o jogo.
-                gameState = PLAYING; // Define o estado como jogando.
+            if (g_world.gameState == GAME_OVER) {
+                initGame(&g_world); // Reinicia o jogo.
+                g_world.gameState = PLAYING; // Define o estado como jogando.
+                redraw = true;
             }
             break;
         case 'p':
         case 'P': // Tecla P (maiúscula ou minúscula).
             // Alterna o estado do jogo entre JOGANDO e PAUSADO.
-            if (gameState == PLAYING) {
-                gameState = PAUSED;
+            if (g_world.gameState == PLAYING) {
+                g_world.gameState = PAUSED;
                 printf("Jogo Pausado.\n");
-            } else if (gameState == PAUSED) {
-                gameState = PLAYING;
+            } else if (g_world.gameState == PAUSED) {
+                g_world.gameState = PLAYING;
                 printf("Jogo Retomado.\n");
             }
+            redraw = true;
             break;
         
+        case 'b':
+        case 'B': // Tecla B: alterna entre jogador humano, bot reativo e planejador.
+            g_autoPlay = (AutoPlayMode)((g_autoPlay + 1) % (AUTO_PLAY_PLANNER + 1));
+            printf("Jogador automatico: %s.\n", g_autoPlay == AUTO_PLAY_BOT ? "bot" : g_autoPlay == AUTO_PLAY_PLANNER ? "planejador" : "desligado");
+            redraw = true;
+            break;
+
         // PULO com a tecla W.
         case 'w':
         case 'W':
             // O jogador só pode pular se o jogo estiver rodando, se não estiver já pulando e não estiver agachado.
-            if (gameState == PLAYING && !player.jumping && !player.ducking) {
-                player.jumping = 1; // Ativa a flag de pulo.
-                player.jumpVelocity = JUMP_INITIAL_VELOCITY; // Dá ao jogador o impulso inicial do pulo.
+            if (g_world.gameState == PLAYING && playerJump(&g_world)) {
                 printf("Tecla W - Pulo iniciado.\n");
             }
             break;
@@ -66,18 +77,21 @@ void keyboard(unsigned char key, int x, int y) {
         case 's':
         case 'S':
             // O jogador só pode agachar se estiver jogando e não estiver no meio de um pulo.
-            if (gameState == PLAYING && !player.jumping) {
-                player.ducking = 1; // Ativa a flag de agachado.
+            if (g_world.gameState == PLAYING && playerSetDucking(&g_world, 1)) {
                 printf("Tecla S - Agachado.\n");
             }
             break;
 
         // Seleção de lixo com as teclas numéricas (atalho opcional).
-        case '1': if(gameState == PLAYING) player.selectedTrash = PAPER;   printf("Lixo selecionado: Papel\n"); break;
-        case '2': if(gameState == PLAYING) player.selectedTrash = GLASS;   printf("Lixo selecionado: Vidro\n"); break;
-        case '3': if(gameState == PLAYING) player.selectedTrash = PLASTIC; printf("Lixo selecionado: Plastico\n"); break;
-        case '4': if(gameState == PLAYING) player.selectedTrash = METAL;   printf("Lixo selecionado: Metal\n"); break;
-        case '5': if(gameState == PLAYING) player.selectedTrash = ORGANIC; printf("Lixo selecionado: Organico\n"); break;
+        case '1': if(g_world.gameState == PLAYING) g_world.player.selectedTrash = PAPER;   printf("Lixo selecionado: Papel\n"); break;
+        case '2': if(g_world.gameState == PLAYING) g_world.player.selectedTrash = GLASS;   printf("Lixo selecionado: Vidro\n"); break;
+        case '3': if(g_world.gameState == PLAYING) g_world.player.selectedTrash = PLASTIC; printf("Lixo selecionado: Plastico\n"); break;
+        case '4': if(g_world.gameState == PLAYING) g_world.player.selectedTrash = METAL;   printf("Lixo selecionado: Metal\n"); break;
+        case '5': if(g_world.gameState == PLAYING) g_world.player.selectedTrash = ORGANIC; printf("Lixo selecionado: Organico\n"); break;
+    }
+    if (redraw) {
+        refreshGameLoop();
+        glutPostRedisplay();
     }
 }
 
@@ -88,8 +102,8 @@ void keyboardUp(unsigned char key, int x, int y) {
     switch (key) {
         case 's':
         case 'S': // Se a tecla 'S' for solta...
-            if (gameState == PLAYING) {
-                player.ducking = 0; // O jogador para de agachar.
+            if (g_world.gameState == PLAYING) {
+                playerSetDucking(&g_world, 0); // O jogador para de agachar.
                 printf("Tecla S solta - Levantou.\n");
             }
             break;
@@ -100,21 +114,24 @@ void keyboardUp(unsigned char key, int x, int y) {
  * Callback do GLUT para teclas ESPECIAIS pressionadas (Setas, F1, etc.).
  */
 void specialKeyboard(int key, int x, int y) {
+    // F3 mostra/esconde os contadores de desenho em qualquer tela.
+    if (key == GLUT_KEY_F3) {
+        g_showRenderStats = !g_showRenderStats;
+        glutPostRedisplay();
+        return;
+    }
     // Ações das setas só funcionam durante o jogo.
-    if (gameState == PLAYING) {
+    if (g_world.gameState == PLAYING) {
         switch (key) {
             case GLUT_KEY_UP: // Seta para Cima.
                 // Mesma lógica da tecla W.
-                if (!player.jumping && !player.ducking) {
-                    player.jumping = 1;
-                    player.jumpVelocity = JUMP_INITIAL_VELOCITY;
+                if (playerJump(&g_world)) {
                      printf("Seta CIMA - Pulo iniciado.\n");
                 }
                 break;
             case GLUT_KEY_DOWN: // Seta para Baixo.
                 // Mesma lógica da tecla S.
-                 if (!player.jumping) {
-                    player.ducking = 1;
+                 if (playerSetDucking(&g_world, 1)) {
                     printf("Seta BAIXO - Agachado.\n");
                 }
                 break;
@@ -126,10 +143,10 @@ void specialKeyboard(int key, int x, int y) {
  * Callback do GLUT para quando uma tecla ESPECIAL é solta.
  */
 void specialKeyboardUp(int key, int x, int y) {
-    if (gameState == PLAYING) {
+    if (g_world.gameState == PLAYING) {
         switch (key) {
             case GLUT_KEY_DOWN: // Soltou a seta para baixo.
-                player.ducking = 0; // O jogador para de agachar.
+                playerSetDucking(&g_world, 0); // O jogador para de agachar.
                 printf("Seta BAIXO solta - Levantou.\n");
                 break;
         }
@@ -143,20 +160,24 @@ void mouse(int button, int state, int x, int y) {
     // A coordenada Y do mouse em GLUT é invertida (0 é no topo), então a corrigimos
     // para corresponder ao sistema de coordenadas do OpenGL (0 é na base).
     int inverted_y = g_currentWindowHeight - y;
+    // Se o clique mudou a tela (troca de estado ou de menu). Cliques que não acertam nada não redesenham.
+    bool redraw = false;
 
     // Ação só ocorre quando o botão é pressionado (e não quando é solto).
     if (state == GLUT_DOWN && button == GLUT_LEFT_BUTTON) {
         
         // --- Lógica de Clique para o Menu ---
-        if (gameState == MENU) {
+        if (g_world.gameState == MENU) {
             if (!showControls) { // Se estiver na tela principal do menu...
                 if (isClickInside(x, inverted_y, startButton)) {
                     printf("Botao Iniciar Jogo clicado.\n");
-                    initGame(); // Inicia o jogo.
+                    initGame(&g_world); // Inicia o jogo.
+                    redraw = true;
                 }
                 else if (isClickInside(x, inverted_y, controlsButton)) {
                     printf("Botao Controles clicado.\n");
                     showControls = true; // Mostra a tela de controles.
+                    redraw = true;
                 }
                 else if (isClickInside(x, inverted_y, exitButton)) {
                     printf("Botao Sair clicado. Fechando o jogo.\n");
@@ -166,27 +187,33 @@ void mouse(int button, int state, int x, int y) {
                 if (isClickInside(x, inverted_y, backButton)) {
                     printf("Botao Voltar clicado.\n");
                     showControls = false; // Volta para o menu principal.
+                    redraw = true;
                 }
             }
         }
         // --- Lógica de Clique durante o Jogo ---
-        else if (gameState == PLAYING) {
-            spawnThrownTrashItem(); // Arremessa o lixo.
+        else if (g_world.gameState == PLAYING) {
+            spawnThrownTrashItem(&g_world); // Arremessa o lixo.
         }
         // --- Lógica de Clique na Tela de Pausa ---
-        else if (gameState == PAUSED) {
+        else if (g_world.gameState == PAUSED) {
             if (isClickInside(x, inverted_y, backToMenuButton)) {
                 printf("Botao 'Voltar ao Menu' clicado.\n");
-                gameState = MENU; // Muda o estado do jogo para MENU.
+                g_world.gameState = MENU; // Muda o estado do jogo para MENU.
                 showControls = false; // Garante que o menu principal seja mostrado da próxima vez.
+                redraw = true;
             }
         }
     }
     // Ação do botão direito do mouse durante o jogo.
-    else if (gameState == PLAYING && state == GLUT_DOWN && button == GLUT_RIGHT_BUTTON) {
-         cycleSelectedTrash(); // Troca o tipo de lixo selecionado.
+    else if (g_world.gameState == PLAYING && state == GLUT_DOWN && button == GLUT_RIGHT_BUTTON) {
+         cycleSelectedTrash(&g_world); // Troca o tipo de lixo selecionado.
     }
     
     // Pede para o GLUT redesenhar a tela, para que as mudanças no menu (se houver) apareçam.
-    glutPostRedisplay();
+    // Durante a partida o laço de jogo já redesenha a cada quadro.
+    if (redraw) {
+        refreshGameLoop();
+        glutPostRedisplay();
+    }
 }
\ No newline at end of file
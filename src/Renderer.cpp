@@ -2,21 +2,92 @@
 #include "Globals.h"
 #include "Config.h"
 #include "Texture.h"
+#include "SpriteBatch.h"
+#include "TextRenderer.h"
 #include "Player.h"
+#include "GameLoop.h" // Para g_renderAlpha, a fração do passo usada na interpolação.
 #include <GL/glut.h>
 #include <stdio.h>
 #include <string.h>
+#include <math.h>
+#include <chrono> // Para medir o custo de CPU de cada quadro
 
 // Protótipos para funções de desenho que são usadas apenas dentro deste arquivo.
-void drawGame();
+void drawGame(const GameWorld_s* world);
 void drawMenu();
-void drawPause();
-void drawGameOver();
-void drawBackground();
-void drawObstacles();
-void drawTrashBins();
-void drawThrownTrashItems();
+void drawPause(const GameWorld_s* world);
+void drawGameOver(const GameWorld_s* world);
+void drawBackground(const GameWorld_s* world);
+void drawObstacles(const GameWorld_s* world);
+void drawTrashBins(const GameWorld_s* world);
+void drawThrownTrashItems(const GameWorld_s* world);
+void drawPlayer(const GameWorld_s* world);
 void drawButton(Button_s button, const char* text);
+void drawRenderStats();
+void drawHud(const GameWorld_s* world);
+void drawSpriteStress();
+void addSceneSprites(const GameWorld_s* world);
+
+// Lote com os sprites da cena do jogo. drawBackground, drawObstacles etc. apenas anotam os sprites;
+// drawGame envia todos de uma vez com spriteBatchFlush.
+static SpriteBatch_s sceneBatch;
+// Caminho OpenGL 3.3 (opção --renderer core). Só é usado se coreRendererInit der certo.
+static CoreRenderer_s coreRenderer;
+// Tempo de CPU do último quadro desenhado (do glClear até antes da troca de buffers).
+static double lastFrameSeconds = 0.0;
+// Caminho instanciado: instâncias escritas no último quadro e o tempo gasto escrevendo-as.
+static int lastInstanceCount = 0;
+static double lastInstanceSeconds = 0.0;
+// Texto de todas as telas (atlas de glifos). É montado no primeiro quadro, com a janela já visível.
+static TextRenderer_s textRenderer;
+static int textRendererTried = 0;
+
+// HUD retido: os textos de pontos, vidas, lixo e jogador automático ficam montados em um bloco e só
+// são formatados e montados de novo quando um dos valores mostrados (ou o tamanho da janela) muda.
+typedef struct {
+    int valid;                  // 0 = precisa montar (ou o atlas de glifos não está pronto).
+    int score, lives, selectedTrash, autoPlay;
+    int windowWidth, windowHeight;
+    TextBlock_s block;
+    int rebuilds;               // Quantas vezes o HUD foi montado.
+    int frames;                 // Quantos quadros desenharam o HUD.
+} HudCache_s;
+static HudCache_s hud;
+
+// Quadro congelado das telas de pausa e de fim de jogo: a cena, o HUD e a camada escura são
+// desenhados uma vez e copiados para uma textura; enquanto nada muda, a tela é só essa textura.
+typedef struct {
+    GLuint texture;
+    int textureWidth, textureHeight; // Tamanho da textura (o da janela quando ela foi criada).
+    int valid;                  // 0 = capturar de novo no próximo quadro.
+    int gameState;              // Tela (e opções que aparecem na imagem) do momento da captura.
+    int showRenderStats;
+    int autoPlay;
+    int captures;               // Quantas capturas já foram feitas.
+} FrozenFrame_s;
+static FrozenFrame_s frozenFrame;
+
+/**
+ * Anota no lote o sprite 'spriteId' do atlas de texturas (ver TextureAtlas.h).
+ */
+static void addAtlasSprite(int spriteId, int layer, float x, float y, float width, float height) {
+    const AtlasRegion_s* region = &g_atlas.regions[spriteId];
+    // No caminho instanciado o sprite vai direto para o buffer da GPU; a ordem de chamada já é a das camadas.
+    if (g_renderBackend == RENDER_BACKEND_INSTANCED) {
+        coreRendererAddInstance(&coreRenderer, region->texture, x, y, width, height, region->uv16);
+        return;
+    }
+    spriteBatchAddRegion(&sceneBatch, region->texture, layer, x, y, width, height,
+                         region->u0, region->v0, region->u1, region->v1);
+}
+
+/**
+ * Posição a ser desenhada entre o valor do passo anterior e o do passo atual da simulação.
+ * Assim o movimento fica suave mesmo quando a tela é desenhada mais vezes que a simulação avança.
+ */
+static float interpolate(float previous, float current) {
+    return previous + (current - previous) * g_renderAlpha;
+}
 
 
 /**
@@ -24,16 +95,32 @@ void drawButton(Button_s button, const char* text);
  * Atua como um "roteador" que decide qual cena desenhar com base no estado do jogo.
  */
 void display() {
+    if (!textRendererTried) {
+        textRendererTried = 1;
+        if (!textRendererInit(&textRenderer)) {
+            fprintf(stderr, "Atlas de glifos indisponivel; o texto sera desenhado pelo GLUT.\n");
+        }
+    }
+    std::chrono::steady_clock::time_point frameStart = std::chrono::steady_clock::now();
     // Limpa o buffer de cores com a cor de fundo definida em main.cpp.
     glClear(GL_COLOR_BUFFER_BIT);
 
     // Usa um switch para chamar a função de desenho apropriada para o estado atual do jogo.
-    switch (gameState) {
+    // O mundo desenhado é o da janela (g_world); as funções de desenho recebem o mundo explicitamente.
+    // Fora da pausa e do fim de jogo o mundo pode mudar, então a próxima tela parada captura de novo.
+    if (g_world.gameState == PLAYING || g_world.gameState == MENU) frozenFrame.valid = 0;
+    switch (g_world.gameState) {
         case MENU:      drawMenu(); break;
-        case PLAYING:   drawGame(); break;
-        case PAUSED:    drawPause(); break;
-        case GAME_OVER: drawGameOver(); break;
+        case PLAYING:   drawGame(&g_world); break;
+        case PAUSED:    drawPause(&g_world); break;
+        case GAME_OVER: drawGameOver(&g_world); break;
     }
+    // O texto de cada tela é acumulado e desenhado de uma vez, por cima de tudo.
+    textFlush(&textRenderer);
+    textEndFrame(&textRenderer);
+    // A troca de buffers pode esperar a sincronização vertical, então fica fora da medição.
+    std::chrono::duration<double> frameTime = std::chrono::steady_clock::now() - frameStart;
+    lastFrameSeconds = frameTime.count();
     // Troca o buffer de fundo (onde desenhamos) pelo buffer da frente (o que é exibido).
     // Essencial para animações suaves, evitando o efeito de "piscar" (flickering).
     glutSwapBuffers();
@@ -50,6 +137,8 @@ void reshape(int w, int h) {
     // Atualiza as variáveis globais com as novas dimensões da janela.
     g_currentWindowWidth = w;
     g_currentWindowHeight = h;
+    // A lógica também usa a largura (onde os objetos nascem e somem).
+    setWorldViewWidth(&g_world, w);
 
     // --- CÁLCULO DA ESCALA DINÂMICA ---
     // Calcula um fator de escala para que os elementos do jogo se ajustem à altura da janela.
@@ -82,16 +171,10 @@ void reshape(int w, int h) {
 
 /**
  * Função auxiliar para desenhar texto na tela.
+ * O texto é apenas anotado (ver TextRenderer.h) e aparece no próximo textFlush.
  */
 void drawText(float x, float y, float r, float g, float b, void* font, const char *string) {
-    // Define a cor do texto.
-    glColor3f(r, g, b);
-    // Define a posição inicial do texto na tela.
-    glRasterPos2f(x, y);
-    // Itera sobre a string e desenha cada caractere.
-    for (const char* c = string; *c != '\0'; c++) {
-        glutBitmapCharacter(font, *c);
-    }
+    textDraw(&textRenderer, x, y, r, g, b, font, string);
 }
 
 /**
@@ -119,12 +202,8 @@ void drawButton(Button_s button, const char* text) {
     glEnd();
 
     // Calcula a posição do texto para centralizá-lo dentro do botão.
-    int textWidth = 0;
     void* font = GLUT_BITMAP_HELVETICA_18;
-    for (const char* c = text; *c != '\0'; c++) {
-        textWidth += glutBitmapWidth(font, *c);
-    }
-    float textX = button.x + (button.width - textWidth) / 2.0f;
+    float textX = button.x + (button.width - textWidth(&textRenderer, font, text)) / 2.0f;
     float textY = button.y + (button.height / 2.0f) - 7;
     // Desenha o texto.
     drawText(textX, textY, 1.0f, 1.0f, 1.0f, font, text);
@@ -143,10 +222,7 @@ void drawMenu() {
         // --- TELA INICIAL DO MENU ---
         const char* title = "Eco Runner: Missao Reciclar";
         void* titleFont = GLUT_BITMAP_TIMES_ROMAN_24;
-        int titleWidth = 0;
-        for (const char* c = title; *c != '\0'; c++) {
-            titleWidth += glutBitmapWidth(titleFont, *c);
-        }
+        int titleWidth = textWidth(&textRenderer, titleFont, title);
         float titleX = (g_currentWindowWidth - titleWidth) / 2.0f;
         drawText(titleX, g_currentWindowHeight - 120, 0.1f, 0.2f, 0.4f, titleFont, title);
 
@@ -174,7 +250,9 @@ void drawMenu() {
         
         // Linhas seguintes ajustadas.
         drawText(x_pos, y_pos - 150, 0.0f, 0.0f, 0.0f, font, "P: Pausar / Retomar Jogo");
-        drawText(x_pos, y_pos - 180, 0.0f, 0.0f, 0.0f, font, "ESC: Sair do Jogo");
+        drawText(x_pos, y_pos - 180, 0.0f, 0.0f, 0.0f, font, "B: Jogador Automatico (Bot / Planejador / Desligado)");
+        drawText(x_pos, y_pos - 210, 0.0f, 0.0f, 0.0f, font, "F3: Contadores de desenho");
+        drawText(x_pos, y_pos - 240, 0.0f, 0.0f, 0.0f, font, "ESC: Sair do Jogo");
 
         // Botão para retornar ao menu principal.
         drawButton(backButton, "Voltar");
@@ -184,10 +262,32 @@ void drawMenu() {
 /**
  *  Desenha a cena principal do jogo quando o estado é PLAYING.
  */
-void drawGame() {
+void drawGame(const GameWorld_s* world) {
     glEnable(GL_BLEND);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
+    if (g_renderBackend == RENDER_BACKEND_INSTANCED) {
+        // Caminho instanciado: as funções de desenho escrevem os sprites direto no buffer mapeado.
+        // O espaço reservado é o máximo possível: dois fundos, o jogador e todas as entidades dos pools.
+        coreRendererSetTransform(&coreRenderer, (float)g_currentWindowWidth, (float)g_currentWindowHeight,
+                                 g_dynamicScale, cameraX, cameraY);
+        int maxInstances = 3 + world->obstacles.count + world->trashBins.count + world->thrownTrashItems.count + g_spriteStress;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        coreRendererBeginInstances(&coreRenderer, maxInstances);
+        addSceneSprites(world);
+        lastInstanceCount = coreRenderer.instanceCount;
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        lastInstanceSeconds = elapsed.count();
+        coreRendererEndInstances(&coreRenderer);
+    } else if (sceneBatch.core) {
+        // Caminho OpenGL 3.3: a escala e a câmera vão para o shader como uma única matriz,
+        // sem a pilha de matrizes do pipeline fixo.
+        coreRendererSetTransform(&coreRenderer, (float)g_currentWindowWidth, (float)g_currentWindowHeight,
+                                 g_dynamicScale, cameraX, cameraY);
+        addSceneSprites(world);
+        spriteBatchFlush(&sceneBatch);
+    } else {
+
     // Salva a matriz de transformação atual. Isso é como criar um "checkpoint".
     glPushMatrix();
 
@@ -200,66 +300,165 @@ void drawGame() {
 
         // 3. Desenha todos os elementos do MUNDO DO JOGO.
         // Estes elementos serão afetados pela câmera e pela escala.
+        // Cada função anota seus sprites no lote com a sua camada; o flush desenha tudo em poucas chamadas.
         glEnable(GL_TEXTURE_2D);
-            drawBackground();
-            drawTrashBins();
-            drawObstacles();
-            drawThrownTrashItems();
-            drawPlayer();
+            addSceneSprites(world);
+            spriteBatchFlush(&sceneBatch);
         glDisable(GL_TEXTURE_2D);
 
     // Restaura a matriz de transformação ao seu estado anterior (antes do PushMatrix).
     // Isso "remove" a escala e a translação da câmera para os desenhos seguintes.
     glPopMatrix();
+    }
 
 
     // 4. Desenha o HUD (Heads-Up Display: placar, vidas, etc.).
     // Como está fora do bloco Push/Pop Matrix, o HUD não é afetado pela câmera nem pela escala.
     // Isso garante que ele fique fixo na tela.
+    drawHud(world);
+    if (g_showRenderStats) drawRenderStats();
+}
+
+/**
+ * Acrescenta uma linha ao bloco do HUD (ou a desenha direto, se o atlas de glifos não existe).
+ */
+static void addHudText(float x, float y, const char* string) {
+    if (!textBlockAdd(&textRenderer, &hud.block, x, y, 0.0f, 0.0f, 0.0f, GLUT_BITMAP_HELVETICA_18, string)) {
+        drawText(x, y, 0.0f, 0.0f, 0.0f, GLUT_BITMAP_HELVETICA_18, string);
+    }
+}
+
+/**
+ * Desenha o HUD. Enquanto pontos, vidas, lixo selecionado, modo automático e tamanho da janela não
+ * mudam, apenas reenvia o bloco já montado, sem sprintf nem medição de texto.
+ */
+void drawHud(const GameWorld_s* world) {
+    hud.frames++;
+    if (hud.valid && hud.score == world->score && hud.lives == world->lives &&
+        hud.selectedTrash == world->player.selectedTrash && hud.autoPlay == g_autoPlay &&
+        hud.windowWidth == g_currentWindowWidth && hud.windowHeight == g_currentWindowHeight) {
+        textDrawBlock(&textRenderer, &hud.block);
+        return;
+    }
+    hud.score = world->score;
+    hud.lives = world->lives;
+    hud.selectedTrash = world->player.selectedTrash;
+    hud.autoPlay = g_autoPlay;
+    hud.windowWidth = g_currentWindowWidth;
+    hud.windowHeight = g_currentWindowHeight;
+    hud.rebuilds++;
+    textBlockClear(&hud.block);
+
     char hudText[100];
-    sprintf(hudText, "Pontos: %d", score);
-    drawText(10, g_currentWindowHeight - 25, 0.0f, 0.0f, 0.0f, GLUT_BITMAP_HELVETICA_18, hudText);
-    sprintf(hudText, "Vidas: %d", lives);
-    drawText(10, g_currentWindowHeight - 50, 0.0f, 0.0f, 0.0f, GLUT_BITMAP_HELVETICA_18, hudText);
-    if (player.selectedTrash >= 0 && player.selectedTrash < TRASH_TYPE_COUNT) {
-        sprintf(hudText, "Lixo: %s", TRASH_TYPE_NAMES[player.selectedTrash]);
-        drawText(g_currentWindowWidth - 200, g_currentWindowHeight - 25, 0.0f, 0.0f, 0.0f, GLUT_BITMAP_HELVETICA_18, hudText);
+    sprintf(hudText, "Pontos: %d", world->score);
+    addHudText(10, g_currentWindowHeight - 25, hudText);
+    sprintf(hudText, "Vidas: %d", world->lives);
+    addHudText(10, g_currentWindowHeight - 50, hudText);
+    if (world->player.selectedTrash >= 0 && world->player.selectedTrash < TRASH_TYPE_COUNT) {
+        sprintf(hudText, "Lixo: %s", TRASH_TYPE_NAMES[world->player.selectedTrash]);
+        addHudText(g_currentWindowWidth - 200, g_currentWindowHeight - 25, hudText);
+    }
+    if (g_autoPlay != AUTO_PLAY_OFF) {
+        addHudText(g_currentWindowWidth - 200, g_currentWindowHeight - 50,
+                   g_autoPlay == AUTO_PLAY_BOT ? "Jogador automatico" : "Planejador");
     }
+    // Sem o atlas o texto já foi desenhado direto e o HUD é montado de novo a cada quadro.
+    hud.valid = textRenderer.texture != 0;
+    if (hud.valid) textDrawBlock(&textRenderer, &hud.block);
 }
 
 /**
- *  Desenha a tela de Pausa.
+ * Anota no lote todos os sprites do mundo, de trás para a frente (cada um na sua camada).
  */
-void drawPause() {
-    // 1. Desenha a cena do jogo congelada no fundo.
-    drawGame(); 
-    // 2. Desenha um retângulo escuro e semi-transparente sobre toda a tela para escurecê-la.
-    glEnable(GL_BLEND); 
-    glColor4f(0.0f, 0.0f, 0.0f, 0.5f); // Cor preta com 50% de opacidade.
-    glBegin(GL_QUADS); 
-        glVertex2f(0,0); 
-        glVertex2f(g_currentWindowWidth,0); 
-        glVertex2f(g_currentWindowWidth,g_currentWindowHeight); 
-        glVertex2f(0,g_currentWindowHeight); 
-    glEnd();
-    glDisable(GL_BLEND);
-    // 3. Desenha o texto e os botões da tela de pausa por cima da camada escura.
-    drawText(g_currentWindowWidth/2.0f - 50, g_currentWindowHeight/2.0f + 10, 1.0f, 1.0f, 1.0f, GLUT_BITMAP_TIMES_ROMAN_24, "PAUSADO");
-    drawText(g_currentWindowWidth/2.0f - 110, g_currentWindowHeight/2.0f - 20, 1.0f, 1.0f, 1.0f, GLUT_BITMAP_HELVETICA_18, "Pressione P para continuar");
+void addSceneSprites(const GameWorld_s* world) {
+    drawBackground(world);
+    drawTrashBins(world);
+    drawObstacles(world);
+    drawThrownTrashItems(world);
+    if (g_spriteStress > 0) drawSpriteStress();
+    drawPlayer(world);
+}
 
-    // --- DESENHA O NOVO BOTÃO AQUI ---
-    drawButton(backToMenuButton, "Voltar ao Menu");
+/**
+ * Mostra os contadores do último lote de sprites e o custo do quadro (tecla F3) no canto inferior esquerdo.
+ */
+void drawRenderStats() {
+    const SpriteBatchStats_s* stats = &sceneBatch.stats;
+    char statsText[160];
+    if (g_renderBackend == RENDER_BACKEND_INSTANCED) {
+        sprintf(statsText, "Sprites: %d | Chamadas de desenho: %d | Bytes: %d | Montagem: %.2f ms",
+                lastInstanceCount, coreRenderer.lastInstanceDraws, lastInstanceCount * (int)sizeof(SpriteInstance_s),
+                lastInstanceSeconds * 1000.0);
+    } else {
+        sprintf(statsText, "Sprites: %d | Chamadas de desenho: %d | Vertices: %d | Montagem: %.2f ms",
+                stats->sprites, stats->drawCalls, stats->vertices, stats->buildSeconds * 1000.0);
+    }
+    drawText(10, 25, 0.0f, 0.0f, 0.0f, GLUT_BITMAP_HELVETICA_12, statsText);
+    const char* backendName = g_renderBackend == RENDER_BACKEND_INSTANCED ? "OpenGL 3.3 instanciado" :
+                              g_renderBackend == RENDER_BACKEND_CORE ? "OpenGL 3.3 (shader + VBO)" : "pipeline fixo";
+    sprintf(statsText, "Quadro (CPU): %.2f ms | Caminho: %s", lastFrameSeconds * 1000.0, backendName);
+    drawText(10, 10, 0.0f, 0.0f, 0.0f, GLUT_BITMAP_HELVETICA_12, statsText);
+    const TextStats_s* textStats = &textRenderer.stats;
+    sprintf(statsText, "Texto: %d glifos em %d chamadas | Layouts: %d reaproveitados, %d medidos",
+            textStats->glyphs, textStats->drawCalls, textStats->layoutHits, textStats->layoutMisses);
+    drawText(10, 40, 0.0f, 0.0f, 0.0f, GLUT_BITMAP_HELVETICA_12, statsText);
+    sprintf(statsText, "HUD: %d montagens em %d quadros | Telas congeladas: %d capturas", hud.rebuilds, hud.frames,
+            frozenFrame.captures);
+    drawText(10, 55, 0.0f, 0.0f, 0.0f, GLUT_BITMAP_HELVETICA_12, statsText);
 }
 
 /**
- *  Desenha a tela de Game Over.
+ * Teste de carga do lote (opção --sprite-stress N): N itens de lixo extras espalhados pela tela,
+ * andando para a esquerda. Não fazem parte da partida; servem só para medir a vazão de sprites.
  */
-void drawGameOver() {
-    // A lógica é a mesma da tela de pausa: desenhar o jogo por baixo e uma camada por cima.
-    drawGame();
-    // A camada de Game Over é mais escura.
-    glEnable(GL_BLEND); 
-    glColor4f(0.1f, 0.1f, 0.1f, 0.85f); // Cor cinza escuro com 85% de opacidade.
+void drawSpriteStress() {
+    float seconds = glutGet(GLUT_ELAPSED_TIME) / 1000.0f;
+    float width = (float)WINDOW_WIDTH;
+    float height = (float)WINDOW_HEIGHT;
+    const float size = 25.0f; // Mesmo tamanho do lixo arremessado de verdade.
+    for (int i = 0; i < g_spriteStress; i++) {
+        // Posições pseudo-aleatórias fixas por índice, deslocadas com o tempo.
+        float x = fmodf(i * 97.31f - seconds * (60.0f + (i % 7) * 20.0f), width + size);
+        if (x < 0) x += width + size;
+        float y = fmodf(i * 53.17f, height);
+        addAtlasSprite(SPRITE_TRASH_ITEM_FIRST + i % TRASH_TYPE_COUNT, SPRITE_LAYER_THROWN_TRASH, x - size, y, size, size);
+    }
+}
+
+/**
+ * Prepara o caminho de desenho escolhido em g_renderBackend. Deve ser chamada depois que a janela
+ * (e o contexto OpenGL) existe. Se o caminho 3.3 não puder ser usado, volta para o pipeline fixo.
+ */
+void initRenderer() {
+    spriteBatchInit(&sceneBatch);
+    if (g_renderBackend != RENDER_BACKEND_LEGACY) {
+        if (coreRendererInit(&coreRenderer)) {
+            // O lote continua existindo no modo instanciado, mas só é usado pelo caminho core.
+            if (g_renderBackend == RENDER_BACKEND_CORE) sceneBatch.core = &coreRenderer;
+        } else {
+            fprintf(stderr, "Caminho OpenGL 3.3 indisponivel; usando o pipeline fixo.\n");
+            g_renderBackend = RENDER_BACKEND_LEGACY;
+        }
+    }
+}
+
+/**
+ * Libera a memória do lote de sprites da cena, o atlas de glifos, o quadro congelado e os recursos do caminho 3.3.
+ */
+void cleanupRenderer() {
+    if (g_renderBackend != RENDER_BACKEND_LEGACY) coreRendererFree(&coreRenderer);
+    spriteBatchFree(&sceneBatch);
+    textBlockFree(&hud.block);
+    if (frozenFrame.texture) glDeleteTextures(1, &frozenFrame.texture);
+    textRendererFree(&textRenderer);
+}
+
+/**
+ * Cobre a tela inteira com um retângulo da cor e opacidade dadas (escurece a cena das telas paradas).
+ */
+static void drawScreenShade(float r, float g, float b, float a) {
+    glEnable(GL_BLEND);
+    glColor4f(r, g, b, a);
     glBegin(GL_QUADS);
         glVertex2f(0,0);
         glVertex2f(g_currentWindowWidth,0);
@@ -267,9 +466,85 @@ void drawGameOver() {
         glVertex2f(0,g_currentWindowHeight);
     glEnd();
     glDisable(GL_BLEND);
+}
+
+/**
+ * Fundo das telas de pausa e de fim de jogo: a cena congelada coberta pela camada escura.
+ * Na primeira vez (ou depois de a janela, a tela ou o HUD mudarem) a cena é desenhada por completo
+ * e o resultado é copiado do buffer de fundo para uma textura. Nos quadros seguintes, o fundo é
+ * apenas essa textura, desenhada em um único retângulo do tamanho da janela.
+ */
+static void drawFrozenScene(const GameWorld_s* world, float r, float g, float b, float a) {
+    int width = g_currentWindowWidth;
+    int height = g_currentWindowHeight;
+    if (frozenFrame.valid && frozenFrame.textureWidth == width && frozenFrame.textureHeight == height &&
+        frozenFrame.gameState == world->gameState && frozenFrame.showRenderStats == g_showRenderStats &&
+        frozenFrame.autoPlay == g_autoPlay) {
+        glEnable(GL_TEXTURE_2D);
+        glBindTexture(GL_TEXTURE_2D, frozenFrame.texture);
+        glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
+        glBegin(GL_QUADS);
+            glTexCoord2f(0.0f, 0.0f); glVertex2f(0, 0);
+            glTexCoord2f(1.0f, 0.0f); glVertex2f(width, 0);
+            glTexCoord2f(1.0f, 1.0f); glVertex2f(width, height);
+            glTexCoord2f(0.0f, 1.0f); glVertex2f(0, height);
+        glEnd();
+        glBindTexture(GL_TEXTURE_2D, 0);
+        glDisable(GL_TEXTURE_2D);
+        return;
+    }
+
+    // 1. Desenha a cena do jogo congelada no fundo, com o HUD.
+    drawGame(world);
+    textFlush(&textRenderer); // O HUD fica embaixo da camada escura.
+    // 2. Desenha um retângulo semi-transparente sobre toda a tela para escurecê-la.
+    drawScreenShade(r, g, b, a);
+
+    // 3. Copia o resultado para a textura (recriada se a janela mudou de tamanho).
+    if (!frozenFrame.texture) glGenTextures(1, &frozenFrame.texture);
+    glBindTexture(GL_TEXTURE_2D, frozenFrame.texture);
+    if (frozenFrame.textureWidth != width || frozenFrame.textureHeight != height) {
+        // GL_NEAREST: um texel por pixel da janela, a cópia volta para a tela sem borrar.
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, NULL);
+        frozenFrame.textureWidth = width;
+        frozenFrame.textureHeight = height;
+    }
+    glReadBuffer(GL_BACK);
+    glCopyTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 0, 0, width, height);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    frozenFrame.valid = 1;
+    frozenFrame.gameState = world->gameState;
+    frozenFrame.showRenderStats = g_showRenderStats;
+    frozenFrame.autoPlay = g_autoPlay;
+    frozenFrame.captures++;
+}
+
+/**
+ *  Desenha a tela de Pausa.
+ */
+void drawPause(const GameWorld_s* world) {
+    // 1. Cena do jogo congelada, escurecida com preto a 50% de opacidade.
+    drawFrozenScene(world, 0.0f, 0.0f, 0.0f, 0.5f);
+    // 2. Desenha o texto e os botões da tela de pausa por cima da camada escura.
+    drawText(g_currentWindowWidth/2.0f - 50, g_currentWindowHeight/2.0f + 10, 1.0f, 1.0f, 1.0f, GLUT_BITMAP_TIMES_ROMAN_24, "PAUSADO");
+    drawText(g_currentWindowWidth/2.0f - 110, g_currentWindowHeight/2.0f - 20, 1.0f, 1.0f, 1.0f, GLUT_BITMAP_HELVETICA_18, "Pressione P para continuar");
+
+    // --- DESENHA O NOVO BOTÃO AQUI ---
+    drawButton(backToMenuButton, "Voltar ao Menu");
+}
+
+/**
+ *  Desenha a tela de Game Over.
+ */
+void drawGameOver(const GameWorld_s* world) {
+    // A lógica é a mesma da tela de pausa: o jogo congelado por baixo e uma camada por cima.
+    // A camada de Game Over é mais escura (cinza escuro com 85% de opacidade).
+    drawFrozenScene(world, 0.1f, 0.1f, 0.1f, 0.85f);
     // Desenha os textos da tela de Game Over.
     drawText(g_currentWindowWidth/2.0f - 70, g_currentWindowHeight/2.0f + 60, 1.0f, 0.2f, 0.2f, GLUT_BITMAP_TIMES_ROMAN_24, "GAME OVER");
-    char finalScoreText[50]; sprintf(finalScoreText, "Pontuacao Final: %d", score);
+    char finalScoreText[50]; sprintf(finalScoreText, "Pontuacao Final: %d", world->score);
     drawText(g_currentWindowWidth/2.0f - 80, g_currentWindowHeight/2.0f + 20, 1.0f, 1.0f, 1.0f, GLUT_BITMAP_HELVETICA_18, finalScoreText);
     drawText(g_currentWindowWidth/2.0f - 130, g_currentWindowHeight/2.0f - 20, 1.0f, 1.0f, 1.0f, GLUT_BITMAP_HELVETICA_18, "Pressione ESPACO para jogar novamente");
     drawText(g_currentWindowWidth/2.0f - 70, g_currentWindowHeight/2.0f - 50, 0.8f, 0.8f, 0.8f, GLUT_BITMAP_HELVETICA_12, "Pressione ESC para sair");
@@ -278,60 +553,86 @@ void drawGameOver() {
 /**
  *Desenha o fundo com efeito de parallax scrolling.
  */
-void drawBackground() {
-    if (!backgroundTexture) return;
-    glBindTexture(GL_TEXTURE_2D, backgroundTexture);
-    glColor3f(1.0f, 1.0f, 1.0f);
+void drawBackground(const GameWorld_s* world) {
+    if (!g_atlas.regions[SPRITE_BACKGROUND].texture) return;
+
+    float offset1 = interpolate(world->prevBackgroundOffset1, world->backgroundOffset1);
+    float offset2 = interpolate(world->prevBackgroundOffset2, world->backgroundOffset2);
 
     // Desenha duas cópias da mesma imagem de fundo, uma ao lado da outra.
     // As variáveis backgroundOffset1 e backgroundOffset2 são atualizadas em GameLogic.cpp
     // para mover as imagens para a esquerda, criando a ilusão de um fundo infinito.
-    glBegin(GL_QUADS);
-        glTexCoord2f(0.0f, 0.0f); glVertex2f(backgroundOffset1, 0);
-        glTexCoord2f(1.0f, 0.0f); glVertex2f(backgroundOffset1 + g_currentWindowWidth, 0);
-        glTexCoord2f(1.0f, 1.0f); glVertex2f(backgroundOffset1 + g_currentWindowWidth, g_currentWindowHeight);
-        glTexCoord2f(0.0f, 1.0f); glVertex2f(backgroundOffset1, g_currentWindowHeight);
-    glEnd();
+    addAtlasSprite(SPRITE_BACKGROUND, SPRITE_LAYER_BACKGROUND, offset1, 0, g_currentWindowWidth, g_currentWindowHeight);
+    addAtlasSprite(SPRITE_BACKGROUND, SPRITE_LAYER_BACKGROUND, offset2, 0, g_currentWindowWidth, g_currentWindowHeight);
+}
 
-    glBegin(GL_QUADS);
-        glTexCoord2f(0.0f, 0.0f); glVertex2f(backgroundOffset2, 0);
-        glTexCoord2f(1.0f, 0.0f); glVertex2f(backgroundOffset2 + g_currentWindowWidth, 0);
-        glTexCoord2f(1.0f, 1.0f); glVertex2f(backgroundOffset2 + g_currentWindowWidth, g_currentWindowHeight);
-        glTexCoord2f(0.0f, 1.0f); glVertex2f(backgroundOffset2, g_currentWindowHeight);
-    glEnd();
+/**
+ * Itera sobre o pool de obstáculos e anota no lote os que estão visíveis.
+ */
+void drawObstacles(const GameWorld_s* world) {
+    // O pool é denso ("object pooling" sem buracos): as posições [0, count) são exatamente os
+    // obstáculos em uso no jogo. Apenas desenhamos os que estão visíveis na tela.
+    for (int i = 0; i < world->obstacles.count; i++) {
+        float x = interpolate(world->obstacles.prevX[i], world->obstacles.x[i]);
+        if (x + world->obstacles.width[i] > 0 && x < g_currentWindowWidth) {
+            addAtlasSprite(SPRITE_OBSTACLE_FIRST + world->obstacles.type[i], SPRITE_LAYER_OBSTACLES, x, interpolate(world->obstacles.prevY[i], world->obstacles.y[i]), world->obstacles.width[i], world->obstacles.height[i]);
+        }
+    }
 }
 
 /**
- * Itera sobre o array de obstáculos e desenha apenas os que estão ativos.
+ * Itera sobre o pool de lixeiras e anota no lote as que estão visíveis.
  */
-void drawObstacles() {
-    for (int i = 0; i < 5; i++) {
-        // A flag 'active' faz parte do sistema de "object pooling".
-        // Apenas desenhamos os obstáculos que estão atualmente em uso no jogo e visíveis na tela.
-        if (obstacles[i].active && obstacles[i].x + obstacles[i].width > 0 && obstacles[i].x < g_currentWindowWidth) {
-            drawQuadWithTexture(obstacleTextures[obstacles[i].type], obstacles[i].x, obstacles[i].y, obstacles[i].width, obstacles[i].height);
+void drawTrashBins(const GameWorld_s* world) {
+    for (int i = 0; i < world->trashBins.count; i++) {
+        float x = interpolate(world->trashBins.prevX[i], world->trashBins.x[i]);
+        if (x + world->trashBins.width[i] > 0 && x < g_currentWindowWidth) {
+            addAtlasSprite(SPRITE_TRASH_BIN_FIRST + world->trashBins.type[i], SPRITE_LAYER_TRASH_BINS, x, interpolate(world->trashBins.prevY[i], world->trashBins.y[i]), world->trashBins.width[i], world->trashBins.height[i]);
         }
     }
 }
 
 /**
- * Itera sobre o array de lixeiras e desenha apenas as que estão ativas.
+ *Itera sobre o pool de lixo arremessado e anota no lote os que estão visíveis.
  */
-void drawTrashBins() {
-    for (int i = 0; i < TRASH_TYPE_COUNT; i++) {
-        if (trashBins[i].active && trashBins[i].x + trashBins[i].width > 0 && trashBins[i].x < g_currentWindowWidth) {
-            drawQuadWithTexture(trashBinTextures[trashBins[i].type], trashBins[i].x, trashBins[i].y, trashBins[i].width, trashBins[i].height);
+void drawThrownTrashItems(const GameWorld_s* world) {
+    for (int i = 0; i < world->thrownTrashItems.count; i++) {
+        float x = interpolate(world->thrownTrashItems.prevX[i], world->thrownTrashItems.x[i]);
+        if (x + world->thrownTrashItems.width[i] > 0 && x < g_currentWindowWidth) {
+            addAtlasSprite(SPRITE_TRASH_ITEM_FIRST + world->thrownTrashItems.type[i], SPRITE_LAYER_THROWN_TRASH, x, interpolate(world->thrownTrashItems.prevY[i], world->thrownTrashItems.y[i]), world->thrownTrashItems.width[i], world->thrownTrashItems.height[i]);
         }
     }
 }
 
 /**
- *Itera sobre o array de lixo arremessado e desenha apenas os que estão ativos.
+ * Desenha o jogador na tela, escolhendo a textura correta com base no seu estado atual.
  */
-void drawThrownTrashItems() {
-    for (int i = 0; i < 10; i++) {
-        if (thrownTrashItems[i].active && thrownTrashItems[i].x + thrownTrashItems[i].width > 0 && thrownTrashItems[i].x < g_currentWindowWidth) {
-            drawQuadWithTexture(trashItemTextures[thrownTrashItems[i].type], thrownTrashItems[i].x, thrownTrashItems[i].y, thrownTrashItems[i].width, thrownTrashItems[i].height);
+void drawPlayer(const GameWorld_s* world) {
+    // Define um sprite padrão para o caso de nenhum outro ser selecionado.
+    int spriteToUse = SPRITE_PLAYER_RUN1;
+    
+    // --- Lógica de Seleção do Sprite (Máquina de Estados Visual) ---
+    if (world->player.jumping) {
+        // Se estiver pulando, usa o sprite de pulo.
+        spriteToUse = SPRITE_PLAYER_JUMP;
+    } else if (world->player.ducking) {
+        // Se estiver agachado, usa o sprite de agachar.
+        spriteToUse = SPRITE_PLAYER_DUCK;
+    } else { 
+        // Caso contrário (está correndo), alterna entre os dois sprites de corrida.
+        if (world->currentPlayerRunFrame == 0) {
+            spriteToUse = SPRITE_PLAYER_RUN1;
+        } else {
+            spriteToUse = SPRITE_PLAYER_RUN2;
         }
     }
+    // Verificação de segurança: se a imagem selecionada não carregou, usa a padrão.
+    if (!g_atlas.regions[spriteToUse].texture) {
+        spriteToUse = SPRITE_PLAYER_RUN1; 
+    }
+    
+    // Anota o sprite do jogador na camada da frente.
+    // Usa um operador ternário para ajustar a altura do jogador e da sua hitbox:
+    // Se (player.ducking for verdadeiro), a altura é reduzida; senão, usa a altura normal.
+    addAtlasSprite(spriteToUse, SPRITE_LAYER_PLAYER, interpolate(world->player.prevX, world->player.x), interpolate(world->player.prevY, world->player.y), world->player.width, (world->player.ducking ? world->player.height / 1.8f : world->player.height));
 }
\ No newline at end of file
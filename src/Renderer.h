@@ -2,6 +2,7 @@
 #define RENDERER_H
 
 #include <GL/glut.h> // Para void* font
+#include "World.h"    // Para GameWorld_s, o mundo a ser desenhado.
 
 // --- Protótipos de Funções ---
 // Funções responsáveis por desenhar todos os elementos visuais do jogo.
@@ -10,12 +11,15 @@ void display();              // Função principal de desenho, chamada pelo GLUT
 void reshape(int w, int h);    // Chamada quando a janela é redimensionada para ajustar a projeção.
 void drawText(float x, float y, float r, float g, float b, void* font, const char *string); // Desenha uma string de texto na tela.
 void drawMenu();             // Desenha a tela do menu principal e de controles.
-void drawGame();             // Desenha a cena principal do jogo (jogador, obstáculos, etc.).
-void drawPause();            // Desenha a tela de pausa sobre a cena do jogo.
-void drawGameOver();         // Desenha a tela de "Game Over" sobre a cena do jogo.
-void drawBackground();       // Desenha o fundo do jogo.
-void drawObstacles();        // Desenha todos os obstáculos ativos.
-void drawTrashBins();        // Desenha todas as lixeiras ativas.
-void drawThrownTrashItems(); // Desenha todos os itens de lixo arremessados ativos.
+void drawGame(const GameWorld_s* world); // Desenha a cena principal do jogo (jogador, obstáculos, etc.).
+void drawPause(const GameWorld_s* world); // Desenha a tela de pausa sobre a cena do jogo.
+void drawGameOver(const GameWorld_s* world); // Desenha a tela de "Game Over" sobre a cena do jogo.
+void drawBackground(const GameWorld_s* world); // Desenha o fundo do jogo.
+void drawObstacles(const GameWorld_s* world); // Desenha todos os obstáculos ativos.
+void drawTrashBins(const GameWorld_s* world); // Desenha todas as lixeiras ativas.
+void drawThrownTrashItems(const GameWorld_s* world); // Desenha todos os itens de lixo arremessados ativos.
+void drawPlayer(const GameWorld_s* world); // Desenha o jogador com a textura do seu estado atual.
+void initRenderer();         // Prepara o caminho de desenho (pipeline fixo ou OpenGL 3.3), depois de criar a janela.
+void cleanupRenderer();      // Libera a memória do lote de sprites (SpriteBatch.h) e o atlas de glifos (TextRenderer.h).
 
 #endif //RENDERER_H
\ No newline at end of file
@@ -0,0 +1,167 @@
+#include "SpriteBatch.h"
+#include <stdlib.h> // Para malloc, free
+#include <string.h> // Para memset
+#include <chrono>   // Para medir o tempo de montagem do lote
+
+// Floats por sprite no vetor de vértices: 4 cantos com x, y, u, v.
+#define SPRITE_FLOATS 16
+
+void spriteBatchInit(SpriteBatch_s* batch) {
+    memset(batch, 0, sizeof(*batch));
+}
+
+void spriteBatchFree(SpriteBatch_s* batch) {
+    free(batch->sprites);
+    free(batch->keys);
+    free(batch->order);
+    free(batch->scratch);
+    free(batch->vertices);
+    spriteBatchInit(batch);
+}
+
+/**
+ * Dobra a capacidade do lote, preservando os sprites já anotados no quadro.
+ * Os vetores de ordenação e de vértices são reescritos a cada flush, então não precisam ser copiados.
+ */
+static void growBatch(SpriteBatch_s* batch) {
+    int capacity = batch->capacity ? batch->capacity * 2 : 256;
+    batch->sprites = (Sprite_s*)realloc(batch->sprites, sizeof(Sprite_s) * capacity);
+    free(batch->keys);
+    free(batch->order);
+    free(batch->scratch);
+    free(batch->vertices);
+    batch->keys = (unsigned int*)malloc(sizeof(unsigned int) * capacity);
+    batch->order = (int*)malloc(sizeof(int) * capacity);
+    batch->scratch = (int*)malloc(sizeof(int) * capacity);
+    batch->vertices = (float*)malloc(sizeof(float) * SPRITE_FLOATS * capacity);
+    batch->capacity = capacity;
+}
+
+void spriteBatchAddRegion(SpriteBatch_s* batch, GLuint texture, int layer, float x, float y, float width, float height,
+                          float u0, float v0, float u1, float v1) {
+    if (batch->count == batch->capacity) growBatch(batch);
+    Sprite_s* sprite = &batch->sprites[batch->count++];
+    sprite->x = x;
+    sprite->y = y;
+    sprite->width = width;
+    sprite->height = height;
+    sprite->u0 = u0;
+    sprite->v0 = v0;
+    sprite->u1 = u1;
+    sprite->v1 = v1;
+    sprite->texture = texture;
+    sprite->layer = layer;
+}
+
+void spriteBatchAdd(SpriteBatch_s* batch, GLuint texture, int layer, float x, float y, float width, float height) {
+    spriteBatchAddRegion(batch, texture, layer, x, y, width, height, 0.0f, 0.0f, 1.0f, 1.0f);
+}
+
+/**
+ * Ordena os índices dos sprites pela chave (camada nos 8 bits altos, textura nos 24 baixos) com um
+ * radix sort de 8 em 8 bits, que é estável e linear no número de sprites. Passadas em que todas as
+ * chaves têm o mesmo byte (o caso comum: poucas texturas, IDs pequenos) são puladas.
+ */
+static void sortBatch(SpriteBatch_s* batch) {
+    int count = batch->count;
+    int* from = batch->order;
+    int* to = batch->scratch;
+    for (int i = 0; i < count; i++) {
+        batch->keys[i] = ((unsigned int)batch->sprites[i].layer << 24) | (batch->sprites[i].texture & 0xFFFFFFu);
+        from[i] = i;
+    }
+    for (int shift = 0; shift < 32; shift += 8) {
+        int offsets[256] = {0};
+        for (int i = 0; i < count; i++) offsets[(batch->keys[i] >> shift) & 0xFF]++;
+        if (offsets[(batch->keys[0] >> shift) & 0xFF] == count) continue;
+        int total = 0;
+        for (int b = 0; b < 256; b++) {
+            int n = offsets[b];
+            offsets[b] = total;
+            total += n;
+        }
+        for (int i = 0; i < count; i++) {
+            int index = from[i];
+            to[offsets[(batch->keys[index] >> shift) & 0xFF]++] = index;
+        }
+        int* swap = from;
+        from = to;
+        to = swap;
+    }
+    // O resultado pode ter terminado na área de trabalho; 'order' sempre guarda a ordem final.
+    if (from != batch->order) {
+        batch->scratch = batch->order;
+        batch->order = from;
+    }
+}
+
+/**
+ * Escreve os 4 cantos (x, y, u, v) de cada sprite, já na ordem de desenho, no vetor de vértices.
+ */
+static void buildVertices(SpriteBatch_s* batch) {
+    float* v = batch->vertices;
+    for (int i = 0; i < batch->count; i++) {
+        const Sprite_s* s = &batch->sprites[batch->order[i]];
+        float x1 = s->x + s->width;
+        float y1 = s->y + s->height;
+        v[0]  = s->x; v[1]  = s->y; v[2]  = s->u0; v[3]  = s->v0; // Canto inferior esquerdo
+        v[4]  = x1;   v[5]  = s->y; v[6]  = s->u1; v[7]  = s->v0; // Canto inferior direito
+        v[8]  = x1;   v[9]  = y1;   v[10] = s->u1; v[11] = s->v1; // Canto superior direito
+        v[12] = s->x; v[13] = y1;   v[14] = s->u0; v[15] = s->v1; // Canto superior esquerdo
+        v += SPRITE_FLOATS;
+    }
+}
+
+void spriteBatchFlush(SpriteBatch_s* batch) {
+    SpriteBatchStats_s stats = {0, 0, 0, 0.0};
+    if (batch->count == 0) {
+        batch->stats = stats;
+        return;
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    sortBatch(batch);
+    buildVertices(batch);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    // Todos os sprites vêm do mesmo vetor: só o trecho desenhado muda entre as chamadas.
+    int baseVertex = 0;
+    if (batch->core) {
+        baseVertex = coreRendererBegin(batch->core, batch->vertices, batch->count);
+    } else {
+        glColor3f(1.0f, 1.0f, 1.0f);
+        glEnableClientState(GL_VERTEX_ARRAY);
+        glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+        glVertexPointer(2, GL_FLOAT, 4 * sizeof(float), batch->vertices);
+        glTexCoordPointer(2, GL_FLOAT, 4 * sizeof(float), batch->vertices + 2);
+    }
+
+    int first = 0;
+    while (first < batch->count) {
+        GLuint texture = batch->sprites[batch->order[first]].texture;
+        // Sprites seguidos com a mesma textura (mesmo que de camadas diferentes) vão na mesma chamada.
+        int last = first + 1;
+        while (last < batch->count && batch->sprites[batch->order[last]].texture == texture) last++;
+        if (batch->core) {
+            coreRendererDrawRun(texture, baseVertex, first, last - first);
+        } else {
+            glBindTexture(GL_TEXTURE_2D, texture);
+            glDrawArrays(GL_QUADS, first * 4, (last - first) * 4);
+        }
+        stats.drawCalls++;
+        first = last;
+    }
+
+    if (batch->core) {
+        coreRendererEnd();
+    } else {
+        glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+        glDisableClientState(GL_VERTEX_ARRAY);
+    }
+
+    stats.sprites = batch->count;
+    stats.vertices = batch->count * 4;
+    stats.buildSeconds = elapsed.count();
+    batch->stats = stats;
+    batch->count = 0;
+}
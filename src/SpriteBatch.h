@@ -0,0 +1,69 @@
+#ifndef SPRITEBATCH_H
+#define SPRITEBATCH_H
+
+#include <GL/glut.h> // Para GLuint
+#include "CoreRenderer.h"
+
+// --- Lote de Sprites ---
+// Em vez de um glBindTexture + glBegin/glEnd por sprite, os desenhos do quadro são apenas
+// anotados (spriteBatchAdd). Em spriteBatchFlush os sprites são ordenados por camada e textura,
+// os vértices de todos eles são escritos em um único vetor e cada sequência de sprites com a
+// mesma textura vira uma única chamada glDrawArrays.
+//
+// As camadas são desenhadas da menor para a maior; dentro de uma camada, a ordem de chegada é
+// mantida para sprites com a mesma textura (a ordenação é estável).
+//
+// O envio usa vertex arrays do pipeline fixo ou, se 'core' estiver definido, o caminho
+// OpenGL 3.3 de CoreRenderer.h (shader e VBO de streaming).
+
+// Camadas da cena do jogo, de trás para a frente.
+enum SpriteLayer {
+    SPRITE_LAYER_BACKGROUND,
+    SPRITE_LAYER_TRASH_BINS,
+    SPRITE_LAYER_OBSTACLES,
+    SPRITE_LAYER_THROWN_TRASH,
+    SPRITE_LAYER_PLAYER,
+    SPRITE_LAYER_COUNT
+};
+
+// Um sprite anotado: retângulo na tela e a região da textura (u0,v0)-(u1,v1) aplicada a ele.
+typedef struct {
+    float x, y, width, height;
+    float u0, v0, u1, v1;
+    GLuint texture;
+    int layer;
+} Sprite_s;
+
+// Contadores do último spriteBatchFlush.
+typedef struct {
+    int sprites;         // Sprites desenhados.
+    int drawCalls;       // Chamadas glDrawArrays (uma por sequência de sprites com a mesma textura).
+    int vertices;        // Vértices enviados (4 por sprite).
+    double buildSeconds; // Tempo de CPU da ordenação e da escrita dos vértices.
+} SpriteBatchStats_s;
+
+typedef struct {
+    Sprite_s* sprites;     // [capacity] sprites anotados no quadro atual.
+    unsigned int* keys;    // [capacity] chave de ordenação (camada e textura) de cada sprite.
+    int* order;            // [capacity] índices dos sprites na ordem de desenho.
+    int* scratch;          // [capacity] área de trabalho da ordenação.
+    float* vertices;       // [capacity * 16] x, y, u, v dos 4 cantos de cada sprite.
+    int count;             // Sprites anotados desde o último flush.
+    int capacity;          // Cresce (dobrando) quando um quadro precisa de mais sprites.
+    SpriteBatchStats_s stats; // Contadores do último flush.
+    CoreRenderer_s* core;  // Caminho OpenGL 3.3 (NULL = pipeline fixo).
+} SpriteBatch_s;
+
+// Prepara um lote vazio (a memória é alocada no primeiro spriteBatchAdd).
+void spriteBatchInit(SpriteBatch_s* batch);
+// Anota um sprite com a textura inteira.
+void spriteBatchAdd(SpriteBatch_s* batch, GLuint texture, int layer, float x, float y, float width, float height);
+// Anota um sprite com apenas uma região (u0,v0)-(u1,v1) da textura.
+void spriteBatchAddRegion(SpriteBatch_s* batch, GLuint texture, int layer, float x, float y, float width, float height,
+                          float u0, float v0, float u1, float v1);
+// Desenha todos os sprites anotados (com a matriz e o estado de GL atuais) e esvazia o lote.
+void spriteBatchFlush(SpriteBatch_s* batch);
+// Libera a memória do lote.
+void spriteBatchFree(SpriteBatch_s* batch);
+
+#endif // SPRITEBATCH_H
@@ -0,0 +1,336 @@
+#include "TextRenderer.h"
+#include <GL/freeglut.h> // Para glutBitmapHeight
+#include <stdlib.h> // Para malloc, realloc, free
+#include <string.h> // Para memset, memcpy, strcmp
+#include <math.h>   // Para floorf
+
+#ifndef GL_CLAMP_TO_EDGE
+#define GL_CLAMP_TO_EDGE 0x812F
+#endif
+
+// Fontes do GLUT que entram no atlas (as únicas usadas pelo jogo).
+static void* textFontHandle(int font) {
+    switch (font) {
+        case 0: return GLUT_BITMAP_HELVETICA_12;
+        case 1: return GLUT_BITMAP_HELVETICA_18;
+        default: return GLUT_BITMAP_TIMES_ROMAN_24;
+    }
+}
+
+/**
+ * Índice da fonte no atlas, ou -1 se a fonte não está nele.
+ */
+static int findFont(void* font) {
+    for (int i = 0; i < TEXT_FONT_COUNT; i++) {
+        if (textFontHandle(i) == font) return i;
+    }
+    return -1;
+}
+
+/**
+ * Índice do glifo de um caractere. Caracteres fora do ASCII imprimível viram '?'.
+ */
+static int glyphIndex(char c) {
+    unsigned char code = (unsigned char)c;
+    if (code < TEXT_FIRST_CHAR || code > TEXT_LAST_CHAR) code = '?';
+    return code - TEXT_FIRST_CHAR;
+}
+
+/**
+ * Largura medida direto no GLUT (antes do atlas existir ou para fontes fora dele).
+ */
+static int glutTextWidth(void* font, const char* string) {
+    int width = 0;
+    for (const char* c = string; *c != '\0'; c++) {
+        width += glutBitmapWidth(font, *c);
+    }
+    return width;
+}
+
+/**
+ * Desenha os glifos de uma fonte em uma grade no buffer de fundo e copia a grade para 'image'
+ * (a partir da linha 'imageY'). O glifo vira branco com alfa 255 onde o GLUT acendeu o pixel.
+ */
+static void captureFont(const GlyphFont_s* font, int columns, int rows, unsigned char* image, int imageY) {
+    glClear(GL_COLOR_BUFFER_BIT);
+    for (int i = 0; i < TEXT_GLYPH_COUNT; i++) {
+        int column = i % columns;
+        int row = i / columns;
+        glRasterPos2i(column * font->cellWidth + font->originX, row * font->cellHeight + font->originY);
+        glutBitmapCharacter(font->glutFont, TEXT_FIRST_CHAR + i);
+    }
+    int height = rows * font->cellHeight;
+    unsigned char* pixels = (unsigned char*)malloc(TEXT_ATLAS_WIDTH * height * 4);
+    glReadPixels(0, 0, TEXT_ATLAS_WIDTH, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    for (int p = 0; p < TEXT_ATLAS_WIDTH * height; p++) {
+        unsigned char* out = image + ((size_t)imageY * TEXT_ATLAS_WIDTH + p) * 4;
+        out[0] = out[1] = out[2] = 255;
+        out[3] = pixels[p * 4] > 127 ? 255 : 0;
+    }
+    free(pixels);
+}
+
+int textRendererInit(TextRenderer_s* text) {
+    memset(text, 0, sizeof(*text));
+
+    // --- Medidas das células ---
+    // Cada glifo do GLUT é um bitmap com a altura da linha, parte dele abaixo da linha de base.
+    // A célula tem uma vez e meia essa altura, com a caneta a meia linha do fundo, o que comporta a
+    // parte de baixo das letras sem precisar saber o seu tamanho exato.
+    int rows[TEXT_FONT_COUNT];
+    int totalHeight = 0, tallestPass = 0;
+    for (int f = 0; f < TEXT_FONT_COUNT; f++) {
+        GlyphFont_s* font = &text->fonts[f];
+        font->glutFont = textFontHandle(f);
+        int lineHeight = glutBitmapHeight(font->glutFont);
+        int widest = 0;
+        for (int i = 0; i < TEXT_GLYPH_COUNT; i++) {
+            font->glyphs[i].advance = glutBitmapWidth(font->glutFont, TEXT_FIRST_CHAR + i);
+            if (font->glyphs[i].advance > widest) widest = font->glyphs[i].advance;
+        }
+        font->cellWidth = widest + 2;
+        font->cellHeight = lineHeight + lineHeight / 2 + 2;
+        font->originX = 1;
+        font->originY = lineHeight / 2 + 1;
+        int columns = TEXT_ATLAS_WIDTH / font->cellWidth;
+        rows[f] = (TEXT_GLYPH_COUNT + columns - 1) / columns;
+        totalHeight += rows[f] * font->cellHeight;
+        if (rows[f] * font->cellHeight > tallestPass) tallestPass = rows[f] * font->cellHeight;
+    }
+
+    // Cada fonte é desenhada na janela antes de ir para o atlas, então ela precisa caber na janela.
+    GLint viewport[4];
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    if (viewport[2] < TEXT_ATLAS_WIDTH || viewport[3] < tallestPass) return 0;
+
+    // --- Captura ---
+    // Projeção em pixels, sem textura nem mistura, para que o GLUT acenda exatamente os pixels do glifo.
+    GLfloat clearColor[4];
+    glGetFloatv(GL_COLOR_CLEAR_VALUE, clearColor);
+    glPushAttrib(GL_ENABLE_BIT | GL_CURRENT_BIT | GL_COLOR_BUFFER_BIT | GL_PIXEL_MODE_BIT);
+    glMatrixMode(GL_PROJECTION);
+    glPushMatrix();
+    glLoadIdentity();
+    glOrtho(0.0, viewport[2], 0.0, viewport[3], -1.0, 1.0);
+    glMatrixMode(GL_MODELVIEW);
+    glPushMatrix();
+    glLoadIdentity();
+    glDisable(GL_TEXTURE_2D);
+    glDisable(GL_BLEND);
+    glColor3f(1.0f, 1.0f, 1.0f);
+    glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+    glReadBuffer(GL_BACK);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+
+    unsigned char* image = (unsigned char*)malloc((size_t)TEXT_ATLAS_WIDTH * totalHeight * 4);
+    int imageY = 0;
+    for (int f = 0; f < TEXT_FONT_COUNT; f++) {
+        GlyphFont_s* font = &text->fonts[f];
+        int columns = TEXT_ATLAS_WIDTH / font->cellWidth;
+        captureFont(font, columns, rows[f], image, imageY);
+        for (int i = 0; i < TEXT_GLYPH_COUNT; i++) {
+            Glyph_s* glyph = &font->glyphs[i];
+            int x = (i % columns) * font->cellWidth;
+            int y = imageY + (i / columns) * font->cellHeight;
+            glyph->u0 = (float)x / TEXT_ATLAS_WIDTH;
+            glyph->v0 = (float)y / totalHeight;
+            glyph->u1 = (float)(x + font->cellWidth) / TEXT_ATLAS_WIDTH;
+            glyph->v1 = (float)(y + font->cellHeight) / totalHeight;
+        }
+        imageY += rows[f] * font->cellHeight;
+    }
+
+    glClear(GL_COLOR_BUFFER_BIT);
+    glClearColor(clearColor[0], clearColor[1], clearColor[2], clearColor[3]);
+    glPopMatrix();
+    glMatrixMode(GL_PROJECTION);
+    glPopMatrix();
+    glMatrixMode(GL_MODELVIEW);
+    glPopAttrib();
+
+    // --- Envio à GPU ---
+    // Filtro GL_NEAREST: cada texel cai em exatamente um pixel da tela.
+    glGenTextures(1, &text->texture);
+    glBindTexture(GL_TEXTURE_2D, text->texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, TEXT_ATLAS_WIDTH, totalHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, image);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    free(image);
+    text->width = TEXT_ATLAS_WIDTH;
+    text->height = totalHeight;
+
+    text->layouts = (TextLayout_s*)malloc(sizeof(TextLayout_s) * TEXT_LAYOUT_CACHE_SIZE);
+    for (int i = 0; i < TEXT_LAYOUT_CACHE_SIZE; i++) text->layouts[i].font = -1;
+    return 1;
+}
+
+/**
+ * Layout do texto no cache (mapeamento direto pelo hash FNV-1a da fonte e do texto). Se a entrada
+ * tiver outro texto, ele é substituído. Retorna NULL para textos maiores que TEXT_LAYOUT_MAX_CHARS.
+ */
+static const TextLayout_s* findLayout(TextRenderer_s* text, int font, const char* string) {
+    unsigned int hash = 2166136261u ^ (unsigned int)font;
+    int length = 0;
+    for (const char* c = string; *c != '\0'; c++, length++) {
+        if (length == TEXT_LAYOUT_MAX_CHARS) return NULL;
+        hash = (hash ^ (unsigned char)*c) * 16777619u;
+    }
+    TextLayout_s* layout = &text->layouts[hash % TEXT_LAYOUT_CACHE_SIZE];
+    if (layout->font == font && strcmp(layout->text, string) == 0) {
+        text->frame.layoutHits++;
+        return layout;
+    }
+    text->frame.layoutMisses++;
+    const GlyphFont_s* glyphFont = &text->fonts[font];
+    layout->font = font;
+    memcpy(layout->text, string, length + 1);
+    layout->glyphCount = 0;
+    int pen = 0;
+    for (int i = 0; i < length; i++) {
+        int glyph = glyphIndex(string[i]);
+        // Espaços só avançam a caneta.
+        if (string[i] != ' ') {
+            layout->offsets[layout->glyphCount] = (short)(pen - glyphFont->originX);
+            layout->glyphs[layout->glyphCount] = (unsigned char)glyph;
+            layout->glyphCount++;
+        }
+        pen += glyphFont->glyphs[glyph].advance;
+    }
+    layout->width = pen;
+    return layout;
+}
+
+int textWidth(TextRenderer_s* text, void* font, const char* string) {
+    int index = findFont(font);
+    if (!text->texture || index < 0) return glutTextWidth(font, string);
+    const TextLayout_s* layout = findLayout(text, index, string);
+    if (layout) return layout->width;
+    int width = 0;
+    for (const char* c = string; *c != '\0'; c++) {
+        width += text->fonts[index].glyphs[glyphIndex(*c)].advance;
+    }
+    return width;
+}
+
+/**
+ * Garante espaço para mais 'glyphs' glifos no bloco.
+ */
+static void reserveGlyphs(TextBlock_s* block, int glyphs) {
+    if (block->glyphCount + glyphs <= block->glyphCapacity) return;
+    int capacity = block->glyphCapacity ? block->glyphCapacity : 256;
+    while (capacity < block->glyphCount + glyphs) capacity *= 2;
+    block->vertices = (TextVertex_s*)realloc(block->vertices, sizeof(TextVertex_s) * 4 * capacity);
+    block->glyphCapacity = capacity;
+}
+
+/**
+ * Acrescenta um glifo (célula inteira) ao bloco.
+ */
+static void addGlyph(TextBlock_s* block, const GlyphFont_s* font, int glyph, float x, float y, const unsigned char color[4]) {
+    reserveGlyphs(block, 1);
+    const Glyph_s* g = &font->glyphs[glyph];
+    float x1 = x + font->cellWidth;
+    float y1 = y + font->cellHeight;
+    TextVertex_s* v = &block->vertices[block->glyphCount++ * 4];
+    v[0].x = x;  v[0].y = y;  v[0].u = g->u0; v[0].v = g->v0;
+    v[1].x = x1; v[1].y = y;  v[1].u = g->u1; v[1].v = g->v0;
+    v[2].x = x1; v[2].y = y1; v[2].u = g->u1; v[2].v = g->v1;
+    v[3].x = x;  v[3].y = y1; v[3].u = g->u0; v[3].v = g->v1;
+    for (int i = 0; i < 4; i++) memcpy(v[i].color, color, 4);
+}
+
+int textBlockAdd(TextRenderer_s* text, TextBlock_s* block, float x, float y, float r, float g, float b, void* font, const char* string) {
+    int index = findFont(font);
+    if (!text->texture || index < 0) return 0;
+    const GlyphFont_s* glyphFont = &text->fonts[index];
+    unsigned char color[4] = { (unsigned char)(r * 255.0f + 0.5f), (unsigned char)(g * 255.0f + 0.5f),
+                               (unsigned char)(b * 255.0f + 0.5f), 255 };
+    // A caneta vai para o pixel inteiro (como glRasterPos faz com o bitmap), então cada texel do
+    // atlas cai em um pixel da tela.
+    float penX = floorf(x);
+    float cellY = floorf(y) - glyphFont->originY;
+    const TextLayout_s* layout = findLayout(text, index, string);
+    if (layout) {
+        reserveGlyphs(block, layout->glyphCount);
+        for (int i = 0; i < layout->glyphCount; i++) {
+            addGlyph(block, glyphFont, layout->glyphs[i], penX + layout->offsets[i], cellY, color);
+        }
+    } else {
+        for (const char* c = string; *c != '\0'; c++) {
+            int glyph = glyphIndex(*c);
+            if (*c != ' ') addGlyph(block, glyphFont, glyph, penX - glyphFont->originX, cellY, color);
+            penX += glyphFont->glyphs[glyph].advance;
+        }
+    }
+    return 1;
+}
+
+void textDraw(TextRenderer_s* text, float x, float y, float r, float g, float b, void* font, const char* string) {
+    int before = text->pending.glyphCount;
+    if (!textBlockAdd(text, &text->pending, x, y, r, g, b, font, string)) {
+        // Sem atlas: o caminho antigo, um glutBitmapCharacter por letra.
+        glColor3f(r, g, b);
+        glRasterPos2f(x, y);
+        for (const char* c = string; *c != '\0'; c++) {
+            glutBitmapCharacter(font, *c);
+        }
+        return;
+    }
+    text->frame.glyphs += text->pending.glyphCount - before;
+}
+
+void textDrawBlock(TextRenderer_s* text, const TextBlock_s* block) {
+    if (block->glyphCount == 0) return;
+    reserveGlyphs(&text->pending, block->glyphCount);
+    memcpy(&text->pending.vertices[text->pending.glyphCount * 4], block->vertices,
+           sizeof(TextVertex_s) * 4 * block->glyphCount);
+    text->pending.glyphCount += block->glyphCount;
+    text->frame.glyphs += block->glyphCount;
+}
+
+void textBlockClear(TextBlock_s* block) {
+    block->glyphCount = 0;
+}
+
+void textBlockFree(TextBlock_s* block) {
+    free(block->vertices);
+    memset(block, 0, sizeof(*block));
+}
+
+void textFlush(TextRenderer_s* text) {
+    TextBlock_s* pending = &text->pending;
+    if (pending->glyphCount == 0) return;
+    glPushAttrib(GL_ENABLE_BIT | GL_CURRENT_BIT | GL_COLOR_BUFFER_BIT | GL_TEXTURE_BIT);
+    glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+    glEnable(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, text->texture);
+    glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE); // Cor do vértice vezes o glifo branco.
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+    glVertexPointer(2, GL_FLOAT, sizeof(TextVertex_s), &pending->vertices[0].x);
+    glTexCoordPointer(2, GL_FLOAT, sizeof(TextVertex_s), &pending->vertices[0].u);
+    glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(TextVertex_s), pending->vertices[0].color);
+    glDrawArrays(GL_QUADS, 0, pending->glyphCount * 4);
+    glPopClientAttrib();
+    glPopAttrib();
+    pending->glyphCount = 0;
+    text->frame.drawCalls++;
+}
+
+void textEndFrame(TextRenderer_s* text) {
+    text->stats = text->frame;
+    memset(&text->frame, 0, sizeof(text->frame));
+}
+
+void textRendererFree(TextRenderer_s* text) {
+    if (text->texture) glDeleteTextures(1, &text->texture);
+    free(text->layouts);
+    textBlockFree(&text->pending);
+    memset(text, 0, sizeof(*text));
+}
@@ -0,0 +1,104 @@
+#ifndef TEXTRENDERER_H
+#define TEXTRENDERER_H
+
+#include <GL/glut.h> // Para GLuint e as fontes do GLUT
+
+// --- Texto com Atlas de Glifos ---
+// Em vez de glRasterPos + um glutBitmapCharacter por letra, os glifos das fontes do GLUT usadas no
+// jogo são desenhados uma única vez em uma textura (o atlas de glifos). Depois disso, cada texto é
+// uma sequência de retângulos texturizados acumulados em um vetor e enviados em uma única chamada
+// de desenho por textFlush.
+//
+// Os glifos são bitmaps pré-rasterizados e são desenhados pixel a pixel (filtro GL_NEAREST e posições
+// inteiras), então o texto fica igual ao do GLUT e nítido com qualquer g_dynamicScale: assim como
+// antes, o texto não é escalado junto com a cena.
+//
+// A largura e os retângulos de cada texto (o "layout") ficam em um cache, então textos repetidos a
+// cada quadro (menu, botões, HUD que não mudou) não são medidos de novo.
+
+#define TEXT_FIRST_CHAR 32          // ' '
+#define TEXT_LAST_CHAR 126          // '~'
+#define TEXT_GLYPH_COUNT (TEXT_LAST_CHAR - TEXT_FIRST_CHAR + 1)
+#define TEXT_FONT_COUNT 3           // Helvetica 12 e 18, Times Roman 24.
+#define TEXT_LAYOUT_CACHE_SIZE 128  // Layouts guardados (mapeamento direto pelo hash do texto).
+#define TEXT_LAYOUT_MAX_CHARS 96    // Textos maiores são montados sem passar pelo cache.
+#define TEXT_ATLAS_WIDTH 512        // Largura do atlas de glifos (as fontes ficam uma embaixo da outra).
+
+// Onde cada glifo ficou no atlas.
+typedef struct {
+    int advance;                    // Quanto a caneta anda depois do glifo (glutBitmapWidth).
+    float u0, v0, u1, v1;           // Célula do glifo no atlas.
+} Glyph_s;
+
+typedef struct {
+    void* glutFont;                 // GLUT_BITMAP_...
+    int cellWidth, cellHeight;      // Tamanho da célula de cada glifo no atlas.
+    int originX, originY;           // Posição da caneta dentro da célula.
+    Glyph_s glyphs[TEXT_GLYPH_COUNT];
+} GlyphFont_s;
+
+// Texto já medido: a largura e, para cada glifo, a posição da célula em relação à caneta.
+typedef struct {
+    int font;                       // Índice em TextRenderer_s.fonts (-1 = entrada vazia).
+    char text[TEXT_LAYOUT_MAX_CHARS + 1];
+    int width;
+    int glyphCount;
+    short offsets[TEXT_LAYOUT_MAX_CHARS]; // x da célula de cada glifo (o y é o mesmo para todos).
+    unsigned char glyphs[TEXT_LAYOUT_MAX_CHARS];
+} TextLayout_s;
+
+// Contadores do último quadro.
+typedef struct {
+    int glyphs;                     // Glifos desenhados.
+    int drawCalls;                  // Chamadas de desenho (uma por textFlush com texto pendente).
+    int layoutHits, layoutMisses;   // Textos encontrados no cache / medidos de novo.
+} TextStats_s;
+
+// Vértice do texto: posição, coordenada no atlas e cor.
+typedef struct {
+    float x, y, u, v;
+    unsigned char color[4];
+} TextVertex_s;
+
+// Retângulos de texto já montados (4 vértices por glifo). O texto pendente do quadro é um bloco;
+// telas que mudam pouco (o HUD) podem guardar o seu bloco e reenviá-lo sem montar de novo.
+typedef struct {
+    TextVertex_s* vertices;
+    int glyphCount, glyphCapacity;
+} TextBlock_s;
+
+typedef struct {
+    GLuint texture;                 // Atlas de glifos (0 = não montado; o texto usa glutBitmapCharacter).
+    int width, height;              // Tamanho do atlas em pixels.
+    GlyphFont_s fonts[TEXT_FONT_COUNT];
+    TextLayout_s* layouts;          // Cache de layouts (TEXT_LAYOUT_CACHE_SIZE entradas).
+    TextBlock_s pending;            // Texto a ser desenhado no próximo textFlush.
+    TextStats_s frame;              // Contadores do quadro em andamento.
+    TextStats_s stats;              // Contadores do último quadro fechado por textEndFrame.
+} TextRenderer_s;
+
+// Monta o atlas de glifos. Precisa da janela já visível (desenha os glifos no buffer de fundo e os
+// lê de volta). Retorna 0 se não for possível; nesse caso o texto continua com glutBitmapCharacter.
+int textRendererInit(TextRenderer_s* text);
+// Largura do texto em pixels (com o cache de layouts).
+int textWidth(TextRenderer_s* text, void* font, const char* string);
+// Acrescenta o texto (com a caneta em x, y) aos retângulos pendentes.
+void textDraw(TextRenderer_s* text, float x, float y, float r, float g, float b, void* font, const char* string);
+// Acrescenta o texto ao bloco 'block' em vez de ao texto pendente. Só funciona com o atlas pronto
+// (retorna 0 se não estiver; o chamador deve usar textDraw).
+int textBlockAdd(TextRenderer_s* text, TextBlock_s* block, float x, float y, float r, float g, float b, void* font, const char* string);
+// Copia os retângulos do bloco para o texto pendente (sem medir nem montar nada).
+void textDrawBlock(TextRenderer_s* text, const TextBlock_s* block);
+// Esvazia o bloco, mantendo a memória para a próxima montagem.
+void textBlockClear(TextBlock_s* block);
+// Libera a memória do bloco.
+void textBlockFree(TextBlock_s* block);
+// Desenha o texto pendente em uma chamada. Deve ser chamada antes de desenhar algo que precise
+// ficar por cima do texto (as camadas escuras da pausa e do fim de jogo, por exemplo).
+void textFlush(TextRenderer_s* text);
+// Fecha os contadores do quadro (copia 'frame' para 'stats').
+void textEndFrame(TextRenderer_s* text);
+// Libera o atlas e os buffers.
+void textRendererFree(TextRenderer_s* text);
+
+#endif // TEXTRENDERER_H
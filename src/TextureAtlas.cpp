@@ -0,0 +1,311 @@
+#include "TextureAtlas.h"
+#include <stdio.h>     // Para printf, fprintf
+#include <stdlib.h>    // Para malloc, calloc, free
+#include <string.h>    // Para memset
+#include <chrono>      // Para medir o tempo de montagem
+#include "stb_image.h" // Carregamento das imagens (a implementação está em main.cpp)
+
+// Alguns cabeçalhos de OpenGL (o do Windows, por exemplo) só vão até a versão 1.1.
+#ifndef GL_CLAMP_TO_EDGE
+#define GL_CLAMP_TO_EDGE 0x812F
+#endif
+
+// Uma imagem já reduzida, à espera de ir para a sua página.
+typedef struct {
+    unsigned char* pixels; // RGBA, linha 0 embaixo (stbi_set_flip_vertically_on_load).
+    int width, height;
+} AtlasImage_s;
+
+// Um trecho da linha do horizonte: de x até x + width, tudo abaixo de y já está ocupado.
+typedef struct {
+    int x, y, width;
+} SkylineSegment_s;
+
+typedef struct {
+    SkylineSegment_s* segments; // No máximo um segmento por coluna da página.
+    int count;
+    int width, height;          // Tamanho máximo da página.
+    int usedHeight;             // Altura do ponto mais alto ocupado.
+} Skyline_s;
+
+static void skylineInit(Skyline_s* skyline, int width, int height) {
+    skyline->segments = (SkylineSegment_s*)malloc(sizeof(SkylineSegment_s) * (width + 1));
+    skyline->segments[0].x = 0;
+    skyline->segments[0].y = 0;
+    skyline->segments[0].width = width;
+    skyline->count = 1;
+    skyline->width = width;
+    skyline->height = height;
+    skyline->usedHeight = 0;
+}
+
+/**
+ * Altura em que um retângulo de largura 'width' fica se começar no segmento 'index':
+ * a mais alta entre os segmentos que ele cobre. Retorna -1 se ele não cabe na página.
+ */
+static int skylineFitAt(const Skyline_s* skyline, int index, int width, int height) {
+    int x = skyline->segments[index].x;
+    if (x + width > skyline->width) return -1;
+    int y = 0;
+    int remaining = width;
+    for (int i = index; remaining > 0; i++) {
+        if (skyline->segments[i].y > y) y = skyline->segments[i].y;
+        if (y + height > skyline->height) return -1;
+        remaining -= skyline->segments[i].width;
+    }
+    return y;
+}
+
+/**
+ * Escolhe a posição mais baixa (e, no empate, mais à esquerda) para o retângulo, ocupa-a e
+ * atualiza a linha do horizonte. Retorna 0 se o retângulo não cabe.
+ */
+static int skylinePlace(Skyline_s* skyline, int width, int height, int* outX, int* outY) {
+    int bestIndex = -1, bestY = 0;
+    for (int i = 0; i < skyline->count; i++) {
+        int y = skylineFitAt(skyline, i, width, height);
+        if (y >= 0 && (bestIndex < 0 || y < bestY)) {
+            bestIndex = i;
+            bestY = y;
+        }
+    }
+    if (bestIndex < 0) return 0;
+
+    SkylineSegment_s* s = skyline->segments;
+    int x = s[bestIndex].x;
+    // O novo segmento (o topo do retângulo) substitui o trecho coberto dos segmentos seguintes.
+    int end = x + width;
+    int next = bestIndex;
+    while (next < skyline->count && s[next].x + s[next].width <= end) next++;
+    if (next < skyline->count && s[next].x < end) {
+        s[next].width -= end - s[next].x;
+        s[next].x = end;
+    }
+    int removed = next - bestIndex;
+    // Abre ou fecha espaço para que exatamente um segmento ocupe o lugar dos 'removed' cobertos.
+    memmove(&s[bestIndex + 1], &s[next], sizeof(SkylineSegment_s) * (skyline->count - next));
+    skyline->count += 1 - removed;
+    s[bestIndex].x = x;
+    s[bestIndex].y = bestY + height;
+    s[bestIndex].width = width;
+    // Junta vizinhos de mesma altura, para a lista não crescer à toa.
+    for (int i = skyline->count - 1; i > 0; i--) {
+        if (s[i].y == s[i - 1].y) {
+            s[i - 1].width += s[i].width;
+            memmove(&s[i], &s[i + 1], sizeof(SkylineSegment_s) * (skyline->count - i - 1));
+            skyline->count--;
+        }
+    }
+
+    if (bestY + height > skyline->usedHeight) skyline->usedHeight = bestY + height;
+    *outX = x;
+    *outY = bestY;
+    return 1;
+}
+
+/**
+ * Carrega a imagem e a reduz (média das áreas, ponderada pelo alfa para que os pixels transparentes
+ * não escureçam as bordas) até que o lado maior caiba em maxSize.
+ */
+static int loadAtlasImage(const char* filename, int maxSize, AtlasImage_s* image) {
+    int width, height, channels;
+    unsigned char* data = stbi_load(filename, &width, &height, &channels, 4);
+    if (!data) {
+        fprintf(stderr, "Falha ao carregar textura: %s (stbi_load: %s)\n", filename, stbi_failure_reason() ? stbi_failure_reason() : "razao desconhecida");
+        return 0;
+    }
+    int largest = width > height ? width : height;
+    if (largest <= maxSize) {
+        image->pixels = data;
+        image->width = width;
+        image->height = height;
+        return 1;
+    }
+
+    int outWidth = (int)((long long)width * maxSize / largest);
+    int outHeight = (int)((long long)height * maxSize / largest);
+    if (outWidth < 1) outWidth = 1;
+    if (outHeight < 1) outHeight = 1;
+    unsigned char* out = (unsigned char*)malloc((size_t)outWidth * outHeight * 4);
+    for (int oy = 0; oy < outHeight; oy++) {
+        int y0 = (int)((long long)oy * height / outHeight);
+        int y1 = (int)((long long)(oy + 1) * height / outHeight);
+        if (y1 <= y0) y1 = y0 + 1;
+        for (int ox = 0; ox < outWidth; ox++) {
+            int x0 = (int)((long long)ox * width / outWidth);
+            int x1 = (int)((long long)(ox + 1) * width / outWidth);
+            if (x1 <= x0) x1 = x0 + 1;
+            unsigned long long r = 0, g = 0, b = 0, a = 0;
+            for (int y = y0; y < y1; y++) {
+                const unsigned char* p = data + ((size_t)y * width + x0) * 4;
+                for (int x = x0; x < x1; x++, p += 4) {
+                    r += (unsigned long long)p[0] * p[3];
+                    g += (unsigned long long)p[1] * p[3];
+                    b += (unsigned long long)p[2] * p[3];
+                    a += p[3];
+                }
+            }
+            unsigned char* q = out + ((size_t)oy * outWidth + ox) * 4;
+            int area = (x1 - x0) * (y1 - y0);
+            q[0] = a ? (unsigned char)(r / a) : 0;
+            q[1] = a ? (unsigned char)(g / a) : 0;
+            q[2] = a ? (unsigned char)(b / a) : 0;
+            q[3] = (unsigned char)(a / area);
+        }
+    }
+    stbi_image_free(data);
+    image->pixels = out;
+    image->width = outWidth;
+    image->height = outHeight;
+    return 1;
+}
+
+/**
+ * Copia a imagem para a página na posição (x, y) (já sem a borda) e preenche a borda de
+ * ATLAS_PADDING pixels repetindo os pixels da beirada da imagem.
+ */
+static void blitWithPadding(unsigned char* page, int pageWidth, const AtlasImage_s* image, int x, int y) {
+    for (int py = -ATLAS_PADDING; py < image->height + ATLAS_PADDING; py++) {
+        int sy = py < 0 ? 0 : (py >= image->height ? image->height - 1 : py);
+        for (int px = -ATLAS_PADDING; px < image->width + ATLAS_PADDING; px++) {
+            int sx = px < 0 ? 0 : (px >= image->width ? image->width - 1 : px);
+            const unsigned char* src = image->pixels + ((size_t)sy * image->width + sx) * 4;
+            unsigned char* dst = page + ((size_t)(y + py) * pageWidth + (x + px)) * 4;
+            dst[0] = src[0];
+            dst[1] = src[1];
+            dst[2] = src[2];
+            dst[3] = src[3];
+        }
+    }
+}
+
+static int nextPowerOfTwo(int value) {
+    int p = 1;
+    while (p < value) p <<= 1;
+    return p;
+}
+
+int buildTextureAtlas(TextureAtlas_s* atlas, const char* const files[SPRITE_COUNT], const int maxSizes[SPRITE_COUNT]) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    memset(atlas, 0, sizeof(*atlas));
+
+    // 1. Carrega e reduz todas as imagens.
+    AtlasImage_s images[SPRITE_COUNT];
+    memset(images, 0, sizeof(images));
+    for (int i = 0; i < SPRITE_COUNT; i++) {
+        if (files[i]) loadAtlasImage(files[i], maxSizes[i], &images[i]);
+    }
+
+    // 2. Empacota das imagens mais altas para as mais baixas (o skyline rende mais assim).
+    int order[SPRITE_COUNT];
+    int imageCount = 0;
+    for (int i = 0; i < SPRITE_COUNT; i++) {
+        if (!images[i].pixels) continue;
+        int j = imageCount++;
+        while (j > 0 && images[order[j - 1]].height < images[i].height) {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = i;
+    }
+
+    GLint maxTextureSize = 0;
+    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTextureSize);
+    int pageSize = ATLAS_PAGE_SIZE;
+    if (maxTextureSize > 0 && maxTextureSize < pageSize) pageSize = maxTextureSize;
+
+    Skyline_s skylines[ATLAS_MAX_PAGES];
+    int allPlaced = 1;
+    for (int k = 0; k < imageCount; k++) {
+        int i = order[k];
+        int paddedWidth = images[i].width + 2 * ATLAS_PADDING;
+        int paddedHeight = images[i].height + 2 * ATLAS_PADDING;
+        int x = 0, y = 0, page = 0;
+        // Tenta as páginas já abertas; se não couber em nenhuma, abre outra.
+        while (page < atlas->pageCount && !skylinePlace(&skylines[page], paddedWidth, paddedHeight, &x, &y)) page++;
+        if (page == atlas->pageCount) {
+            if (atlas->pageCount == ATLAS_MAX_PAGES) {
+                fprintf(stderr, "Atlas: a imagem %s (%dx%d) nao coube em nenhuma pagina.\n", files[i], images[i].width, images[i].height);
+                allPlaced = 0;
+                continue;
+            }
+            skylineInit(&skylines[atlas->pageCount++], pageSize, pageSize);
+            if (!skylinePlace(&skylines[page], paddedWidth, paddedHeight, &x, &y)) {
+                fprintf(stderr, "Atlas: a imagem %s (%dx%d) e maior que uma pagina.\n", files[i], images[i].width, images[i].height);
+                allPlaced = 0;
+                continue;
+            }
+        }
+        AtlasRegion_s* region = &atlas->regions[i];
+        region->page = page;
+        region->x = x + ATLAS_PADDING;
+        region->y = y + ATLAS_PADDING;
+        region->width = images[i].width;
+        region->height = images[i].height;
+        atlas->pages[page].usedPixels += (long long)paddedWidth * paddedHeight;
+    }
+
+    // 3. Monta cada página (só até a altura usada, arredondada para potência de 2) e a envia à GPU.
+    for (int p = 0; p < atlas->pageCount; p++) {
+        AtlasPage_s* page = &atlas->pages[p];
+        page->width = pageSize;
+        page->height = nextPowerOfTwo(skylines[p].usedHeight);
+        unsigned char* pixels = (unsigned char*)calloc((size_t)page->width * page->height, 4);
+        for (int i = 0; i < SPRITE_COUNT; i++) {
+            AtlasRegion_s* region = &atlas->regions[i];
+            if (!images[i].pixels || region->width == 0 || region->page != p) continue;
+            blitWithPadding(pixels, page->width, &images[i], region->x, region->y);
+        }
+
+        glGenTextures(1, &page->texture);
+        glBindTexture(GL_TEXTURE_2D, page->texture);
+        // Sem repetição: fora da região de cada sprite está o sprite vizinho, não a borda oposta.
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, page->width, page->height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        free(pixels);
+        free(skylines[p].segments);
+
+        // As coordenadas de textura só podem ser calculadas agora que a altura da página é conhecida.
+        for (int i = 0; i < SPRITE_COUNT; i++) {
+            AtlasRegion_s* region = &atlas->regions[i];
+            if (!images[i].pixels || region->width == 0 || region->page != p) continue;
+            region->texture = page->texture;
+            region->u0 = (float)region->x / page->width;
+            region->v0 = (float)region->y / page->height;
+            region->u1 = (float)(region->x + region->width) / page->width;
+            region->v1 = (float)(region->y + region->height) / page->height;
+            region->uv16[0] = (unsigned short)(region->u0 * 65535.0f + 0.5f);
+            region->uv16[1] = (unsigned short)(region->v0 * 65535.0f + 0.5f);
+            region->uv16[2] = (unsigned short)(region->u1 * 65535.0f + 0.5f);
+            region->uv16[3] = (unsigned short)(region->v1 * 65535.0f + 0.5f);
+        }
+    }
+
+    for (int i = 0; i < SPRITE_COUNT; i++) {
+        if (images[i].pixels) free(images[i].pixels);
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    atlas->buildSeconds = elapsed.count();
+    return allPlaced;
+}
+
+void printTextureAtlasReport(const TextureAtlas_s* atlas) {
+    printf("Atlas de texturas: %d pagina(s) montada(s) em %.1f ms.\n", atlas->pageCount, atlas->buildSeconds * 1000.0);
+    for (int p = 0; p < atlas->pageCount; p++) {
+        const AtlasPage_s* page = &atlas->pages[p];
+        printf("  Pagina %d (ID: %u): %dx%d, %.1f%% ocupada.\n", p, page->texture, page->width, page->height,
+               100.0 * (double)page->usedPixels / ((double)page->width * page->height));
+    }
+}
+
+void freeTextureAtlas(TextureAtlas_s* atlas) {
+    for (int p = 0; p < atlas->pageCount; p++) {
+        if (atlas->pages[p].texture) glDeleteTextures(1, &atlas->pages[p].texture);
+    }
+    memset(atlas, 0, sizeof(*atlas));
+}
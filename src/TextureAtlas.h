@@ -0,0 +1,69 @@
+#ifndef TEXTUREATLAS_H
+#define TEXTUREATLAS_H
+
+#include <GL/glut.h> // Para GLuint
+#include "Config.h"   // Para OBSTACLE_TYPE_COUNT e TRASH_TYPE_COUNT
+
+// --- Atlas de Texturas ---
+// Todas as imagens do jogo são empacotadas, no carregamento, em uma ou duas texturas grandes
+// ("páginas"). Cada sprite passa a ser uma região (u0,v0)-(u1,v1) de uma página, então um quadro
+// inteiro do jogo é desenhado com a mesma textura e o lote de sprites (SpriteBatch.h) junta tudo
+// em uma única chamada de desenho.
+//
+// O empacotamento usa o algoritmo "skyline" (cada imagem vai no ponto mais baixo da linha do
+// horizonte que a comporta). Em volta de cada imagem há ATLAS_PADDING pixels que repetem a sua
+// borda, para que a filtragem linear não misture a cor de sprites vizinhos.
+
+#define ATLAS_MAX_PAGES 2
+#define ATLAS_PAGE_SIZE 2048 // Lado máximo de uma página (limitado também por GL_MAX_TEXTURE_SIZE).
+#define ATLAS_PADDING 2      // Pixels de borda repetida em volta de cada imagem.
+// As imagens originais têm 1024x1536, muito mais do que aparece na tela. Ao entrar no atlas,
+// cada uma é reduzida para que o lado maior não passe destes limites.
+#define ATLAS_SPRITE_MAX_SIZE 256
+#define ATLAS_BACKGROUND_MAX_SIZE (1024 - 2 * ATLAS_PADDING) // Com a borda, o fundo ocupa exatamente 1024 linhas.
+
+// Identificadores dos sprites no atlas.
+enum SpriteId {
+    SPRITE_PLAYER_RUN1,
+    SPRITE_PLAYER_RUN2,
+    SPRITE_PLAYER_JUMP,
+    SPRITE_PLAYER_DUCK,
+    SPRITE_BACKGROUND,
+    SPRITE_OBSTACLE_FIRST,                                              // + ObstacleType
+    SPRITE_TRASH_BIN_FIRST = SPRITE_OBSTACLE_FIRST + OBSTACLE_TYPE_COUNT, // + TrashType
+    SPRITE_TRASH_ITEM_FIRST = SPRITE_TRASH_BIN_FIRST + TRASH_TYPE_COUNT,  // + TrashType
+    SPRITE_COUNT = SPRITE_TRASH_ITEM_FIRST + TRASH_TYPE_COUNT
+};
+
+// Onde um sprite ficou no atlas. 'texture' é 0 se a imagem não carregou.
+typedef struct {
+    GLuint texture;         // Página (textura do OpenGL) que contém o sprite.
+    float u0, v0, u1, v1;   // Região do sprite na página, em coordenadas de textura.
+    unsigned short uv16[4]; // A mesma região em 16 bits (0 a 65535), como vai nas instâncias (CoreRenderer.h).
+    int page;               // Índice da página.
+    int x, y, width, height; // Região em pixels (sem a borda).
+} AtlasRegion_s;
+
+typedef struct {
+    GLuint texture;
+    int width, height;
+    long long usedPixels;   // Pixels ocupados por imagens (com a borda), para medir o aproveitamento.
+} AtlasPage_s;
+
+typedef struct {
+    AtlasPage_s pages[ATLAS_MAX_PAGES];
+    int pageCount;
+    AtlasRegion_s regions[SPRITE_COUNT];
+    double buildSeconds;    // Tempo de carregamento, redução, empacotamento e envio à GPU.
+} TextureAtlas_s;
+
+// Carrega as imagens 'files[i]' (uma por SpriteId, NULL = sem imagem), reduz cada uma para caber em
+// maxSizes[i], empacota tudo em páginas e envia as páginas para a GPU. Retorna 0 se alguma imagem
+// não coube em nenhuma página (ela fica com textura 0).
+int buildTextureAtlas(TextureAtlas_s* atlas, const char* const files[SPRITE_COUNT], const int maxSizes[SPRITE_COUNT]);
+// Imprime o aproveitamento de cada página e o tempo de montagem.
+void printTextureAtlasReport(const TextureAtlas_s* atlas);
+// Libera as páginas na GPU.
+void freeTextureAtlas(TextureAtlas_s* atlas);
+
+#endif // TEXTUREATLAS_H
@@ -0,0 +1,177 @@
+#include "AutoPlayer.h"
+#include "GameLogic.h"
+#include "Player.h"
+#include "Config.h"
+
+// Quantos passos à frente o bot olha para decidir um desvio (um pulo completo leva ~60 passos).
+#define BOT_HORIZON 70
+// Só pula quando a colisão está a no máximo tantos passos (antes disso o pulo terminaria cedo demais).
+#define BOT_JUMP_LEAD 20
+// Só agacha quando a colisão está a no máximo tantos passos.
+#define BOT_DUCK_LEAD 3
+// Intervalo mínimo, em passos, entre dois arremessos.
+#define BOT_THROW_COOLDOWN 10
+
+// Formas de o jogador passar os próximos passos na simulação do bot.
+enum BotMove { BOT_RUN, BOT_DUCK, BOT_JUMP };
+
+/**
+ * Simula os próximos 'horizon' passos com o jogador fazendo 'move' e os obstáculos rolando
+ * com a velocidade atual. Devolve o primeiro passo (1, 2...) em que o jogador seria atingido,
+ * ou 0 se ele passa limpo; em 'obstacle' fica o índice do obstáculo.
+ * Mesmas contas de updatePlayerAnimation e da caixa de checkAllCollisions.
+ */
+static int firstCollision(const GameWorld_s* world, BotMove move, int horizon, int* obstacle) {
+    const Player_s* player = &world->player;
+    float y = player->y, velocity = player->jumpVelocity;
+    int jumping = player->jumping;
+    int ducking = (move == BOT_DUCK && !jumping);
+    if (move == BOT_JUMP && !jumping) {
+        jumping = 1;
+        velocity = JUMP_INITIAL_VELOCITY;
+        ducking = 0;
+    }
+    float playerLeft = player->x, playerRight = player->x + player->width;
+    float speed = world->currentObstacleSpeed;
+
+    for (int t = 1; t <= horizon; t++) {
+        if (jumping) {
+            y += velocity;
+            velocity -= GRAVITY;
+            if (y <= GROUND_LEVEL) { y = GROUND_LEVEL; jumping = 0; velocity = 0; }
+        }
+        float playerTop = y + (ducking ? player->height / 1.8f : player->height);
+        for (int i = 0; i < world->obstacles.count; i++) {
+            float left = world->obstacles.x[i] - speed * t, right = left + world->obstacles.width[i];
+            float bottom = world->obstacles.y[i], top = bottom + world->obstacles.height[i];
+            if (playerRight > left && playerLeft < right && playerTop > bottom && y < top) {
+                *obstacle = i;
+                return t;
+            }
+        }
+    }
+    return 0;
+}
+
+/**
+ * Passo em que o obstáculo 'i' termina de passar pelo jogador.
+ */
+static int passTick(const GameWorld_s* world, int i) {
+    float distance = world->obstacles.x[i] + world->obstacles.width[i] - world->player.x;
+    return (int)(distance / world->currentObstacleSpeed) + 1;
+}
+
+/**
+ * O movimento evita a colisão prevista com 'threat': ou não bate em nada no horizonte,
+ * ou só bate em outro obstáculo depois que 'threat' já passou.
+ */
+static int avoids(const GameWorld_s* world, BotMove move, int threat) {
+    int obstacle;
+    int hit = firstCollision(world, move, BOT_HORIZON, &obstacle);
+    return hit == 0 || (obstacle != threat && hit > passTick(world, threat));
+}
+
+// --- Desvio ---
+void autoPlayerDodge(GameWorld_s* world) {
+    if (world->player.jumping) return; // No ar não há o que mudar.
+
+    int threat;
+    int hit = firstCollision(world, BOT_RUN, BOT_HORIZON, &threat);
+    if (hit == 0) {
+        if (world->player.ducking) playerSetDucking(world, 0);
+        return;
+    }
+    // Agachado e ainda passando por baixo de algo: continua agachado.
+    if (world->player.ducking && avoids(world, BOT_DUCK, threat)) return;
+
+    if (avoids(world, BOT_DUCK, threat)) {
+        if (hit <= BOT_DUCK_LEAD) playerSetDucking(world, 1);
+    } else if (hit <= BOT_JUMP_LEAD && avoids(world, BOT_JUMP, threat)) {
+        if (world->player.ducking) playerSetDucking(world, 0);
+        playerJump(world);
+    } else if (hit <= 1) {
+        // Nada evita a colisão: tenta ao menos o movimento que a adia mais.
+        int obstacle;
+        int duckHit = firstCollision(world, BOT_DUCK, BOT_HORIZON, &obstacle);
+        int jumpHit = firstCollision(world, BOT_JUMP, BOT_HORIZON, &obstacle);
+        if (jumpHit == 0 || jumpHit > duckHit) {
+            if (world->player.ducking) playerSetDucking(world, 0);
+            playerJump(world);
+        } else {
+            playerSetDucking(world, 1);
+        }
+    }
+}
+
+// --- Arremesso ---
+// Mesma trajetória e caixa do lixo arremessado (ver ThrownTrash.h), a partir da posição do jogador.
+void autoPlayerThrow(GameWorld_s* world) {
+    // Um arremesso recente ainda no ar segura o próximo.
+    for (int i = 0; i < world->thrownTrashItems.count; i++) {
+        if (world->simTick - world->thrownTrashItems.spawnTick[i] < BOT_THROW_COOLDOWN) return;
+    }
+
+    const Player_s* player = &world->player;
+    float x0 = player->x + player->width;
+    float y0 = player->y + (player->ducking ? player->height / 3.6f : player->height / 1.8f);
+    const float size = 25.0f, gravity = GRAVITY * 0.35f;
+    float speed = world->currentObstacleSpeed;
+
+    for (int a = 1; a < BOT_HORIZON; a++) {
+        float left = x0 + TRASH_ITEM_SPEED_X * a;
+        float bottom = (float)(y0 + TRASH_ITEM_INITIAL_SPEED_Y * a - gravity * a * (a - 1) / 2.0);
+        if (bottom < -50 || left > world->viewWidth + 50) return; // Sairia da tela sem acertar nada.
+
+        // Os monstros têm prioridade sobre as lixeiras, como em checkAllCollisions.
+        for (int k = 0; k < world->obstacles.count; k++) {
+            if (world->obstacles.type[k] != MONSTER && world->obstacles.type[k] != FLYING_MONSTER) continue;
+            float targetLeft = world->obstacles.x[k] - speed * a;
+            if (left + size > targetLeft && left < targetLeft + world->obstacles.width[k] &&
+                bottom + size > world->obstacles.y[k] && bottom < world->obstacles.y[k] + world->obstacles.height[k]) {
+                world->player.selectedTrash = METAL; // Só o metal derrota os monstros.
+                spawnThrownTrashItem(world);
+                return;
+            }
+        }
+        for (int j = 0; j < world->trashBins.count; j++) {
+            float targetLeft = world->trashBins.x[j] - speed * 0.90f * a;
+            if (left + size > targetLeft && left < targetLeft + world->trashBins.width[j] &&
+                bottom + size > world->trashBins.y[j] && bottom < world->trashBins.y[j] + world->trashBins.height[j]) {
+                world->player.selectedTrash = world->trashBins.type[j]; // O tipo da lixeira que será atingida.
+                spawnThrownTrashItem(world);
+                return;
+            }
+        }
+    }
+}
+
+void autoPlayerAct(GameWorld_s* world) {
+    if (world->gameState != PLAYING) return;
+    autoPlayerDodge(world);
+    autoPlayerThrow(world);
+}
+
+/**
+ * Número pseudoaleatório em [0, 1) que só depende da semente e do passo (splitmix64).
+ */
+static double lapseDraw(unsigned long long seed, long long tick) {
+    unsigned long long v = seed * 0x9E3779B97F4A7C15ull + (unsigned long long)tick;
+    v = (v ^ (v >> 30)) * 0xBF58476D1CE4E5B9ull;
+    v = (v ^ (v >> 27)) * 0x94D049BB133111EBull;
+    v ^= v >> 31;
+    return (v >> 11) * (1.0 / 9007199254740992.0);
+}
+
+void autoPlayerLapsesInit(AutoPlayerLapses_s* lapses, double rate, double seconds, unsigned long long seed) {
+    lapses->chance = rate * SIM_TICK_SECONDS;
+    lapses->ticks = (int)(seconds / SIM_TICK_SECONDS + 0.5);
+    lapses->seed = seed;
+    lapses->distractedUntil = -1;
+}
+
+void autoPlayerActWithLapses(GameWorld_s* world, AutoPlayerLapses_s* lapses) {
+    if (world->simTick >= lapses->distractedUntil && lapseDraw(lapses->seed, world->simTick) < lapses->chance) {
+        lapses->distractedUntil = world->simTick + lapses->ticks;
+    }
+    if (world->simTick >= lapses->distractedUntil) autoPlayerAct(world);
+}
@@ -0,0 +1,44 @@
+#ifndef AUTOPLAYER_H
+#define AUTOPLAYER_H
+
+#include "World.h"
+
+// --- Jogador Automático (bot) ---
+// Joga sozinho para os testes longos e as medições de desempenho, na janela (tecla B) e no
+// simulador sem tela (ecorunner-sim --bot). Chamado uma vez antes de cada step(), decide as ações
+// com as mesmas funções usadas pelo teclado e pelo mouse (playerJump, playerSetDucking,
+// spawnThrownTrashItem) e com a mesma troca direta do lixo selecionado das teclas 1 a 5.
+//
+// A decisão é feita simulando o futuro próximo com a velocidade atual:
+//  - desvio: se continuar correndo leva a uma colisão, agacha (quando isso basta) ou pula
+//    no primeiro passo em que o pulo inteiro passa limpo;
+//  - arremesso: se a trajetória de um lixo lançado agora acerta primeiro um monstro, arremessa METAL;
+//    se acerta primeiro uma lixeira, arremessa o tipo dela.
+// Não guarda estado próprio: tudo sai do mundo, então funciona igual com retratos e VecEnv.
+
+void autoPlayerAct(GameWorld_s* world);   // Aplica as ações do bot para o próximo passo (só em PLAYING).
+void autoPlayerDodge(GameWorld_s* world); // Só a parte do desvio (pular/agachar).
+void autoPlayerThrow(GameWorld_s* world); // Só a parte do arremesso (também usada pelo planejador, Planner.h).
+
+// --- Distrações ---
+// O bot sozinho quase nunca erra. Nas ferramentas que medem a dificuldade (ecorunner-difficulty,
+// ecorunner-tune) ele joga com "distrações" que imitam um jogador humano: em média 'rate' vezes
+// por segundo ele para de reagir por 'seconds'. Assim a chance de perder vidas cresce com a
+// densidade de obstáculos. Os passos das distrações só dependem da semente da partida: partidas
+// com a mesma semente se distraem nos mesmos passos em qualquer configuração de dificuldade.
+#define AUTOPLAYER_LAPSE_RATE 0.5     // Distrações por segundo, em média (padrão das ferramentas).
+#define AUTOPLAYER_LAPSE_SECONDS 1.0  // Duração de cada distração.
+
+typedef struct {
+    double chance;               // Chance de começar uma distração em cada passo.
+    int ticks;                   // Duração de uma distração, em passos.
+    unsigned long long seed;     // Semente da partida.
+    long long distractedUntil;   // Passo em que a distração atual acaba.
+} AutoPlayerLapses_s;
+
+// Prepara as distrações de uma partida (rate 0 = nunca se distrai).
+void autoPlayerLapsesInit(AutoPlayerLapses_s* lapses, double rate, double seconds, unsigned long long seed);
+// Como autoPlayerAct, mas o bot não age nos passos em que está distraído.
+void autoPlayerActWithLapses(GameWorld_s* world, AutoPlayerLapses_s* lapses);
+
+#endif // AUTOPLAYER_H
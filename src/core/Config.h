@@ -9,15 +9,26 @@
 #define PLAYER_WIDTH 60  
 #define GROUND_LEVEL 100 // A coordenada Y onde o "chão" do jogo se encontra.
 #define OBSTACLE_SPEED_BASE 3.0f // Velocidade inicial dos obstáculos.
+#define OBSTACLE_SPEED_RAMP 0.000015f // A cada passo, a velocidade cresce o tempo de jogo vezes este valor.
 #define JUMP_INITIAL_VELOCITY 22.0f // A força inicial do pulo do jogador.
 #define GRAVITY 0.75f // A força que puxa o jogador para baixo durante um pulo.
 #define TRASH_ITEM_SPEED_X 7.0f // Velocidade horizontal do lixo arremessado.
 #define TRASH_ITEM_INITIAL_SPEED_Y 4.0f // Velocidade vertical inicial do lixo arremessado.
 #define PLAYER_ANIMATION_FRAME_DURATION 0.12f // Duração de cada frame da animação de corrida.
+#define SIM_TICK_SECONDS 0.016f // Duração fixa de um passo da simulação (~60 passos por segundo).
+#define MAX_FRAME_SECONDS 0.25f // Maior intervalo entre quadros que o loop aceita compensar de uma vez.
+// Espaçamentos padrão. Na simulação são parâmetros do mundo (DifficultySettings_s em World.h),
+// que a janela pode substituir pelo preset DIFFICULTY_PRESET_FILE (gerado por ecorunner-tune).
 #define MIN_OBSTACLE_SPACING 450 
 #define RAND_OBSTACLE_SPACING 300 
 #define MIN_TRASHBIN_SPACING 400  
-#define RAND_TRASHBIN_SPACING 250 
+#define RAND_TRASHBIN_SPACING 250
+// Menor espaçamento mínimo jogável (obstáculos e lixeiras): a largura do maior obstáculo (o buraco)
+// mais a do jogador. ecorunner-tune não propõe menos que isso, e um preset com menos é recusado.
+#define MIN_PLAYABLE_SPACING (90 + PLAYER_WIDTH)
+#define DIFFICULTY_PRESET_FILE "difficulty.cfg" // Lido na pasta de trabalho ao iniciar o jogo. 
+#define OBSTACLE_WAVE_SIZE 5 // Quantos obstáculos existem ao mesmo tempo (são reciclados ao sair da tela).
+#define TRASH_ITEM_POOL_CAPACITY 10 // Capacidade inicial do pool de lixo arremessado (cresce se precisar).
 // --- Estados do Jogo ---
 // Usar um 'enum' torna o código mais legível do que usar números (ex: if (gameState == 1)).
 enum GameState { 
@@ -0,0 +1,80 @@
+#include "DifficultyPreset.h"
+#include "Config.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+// Tira os espaços do início e do fim (no próprio texto).
+static char* trim(char* text) {
+    while (isspace((unsigned char)*text)) text++;
+    char* end = text + strlen(text);
+    while (end > text && isspace((unsigned char)end[-1])) end--;
+    *end = '\0';
+    return text;
+}
+
+// Lê um inteiro de 'minimum' em diante; devolve 0 se o texto não for um.
+static int parseSpacing(const char* text, int minimum, int* value) {
+    char* end;
+    long parsed = strtol(text, &end, 10);
+    if (end == text || *end != '\0' || parsed < minimum || parsed > 100000) return 0;
+    *value = (int)parsed;
+    return 1;
+}
+
+int loadDifficultyPreset(const char* path, DifficultySettings_s* settings) {
+    FILE* file = fopen(path, "r");
+    if (!file) return 0;
+
+    char line[256];
+    int lineNumber = 0;
+    while (fgets(line, sizeof(line), file)) {
+        lineNumber++;
+        char* text = trim(line);
+        if (*text == '\0' || *text == '#') continue;
+        char* equals = strchr(text, '=');
+        if (!equals) {
+            printf("%s:%d: linha sem '=' ignorada.\n", path, lineNumber);
+            continue;
+        }
+        *equals = '\0';
+        char* name = trim(text);
+        char* value = trim(equals + 1);
+
+        int ok = 1;
+        if (strcmp(name, "speed_ramp") == 0) {
+            char* end;
+            float ramp = strtof(value, &end);
+            ok = end != value && *end == '\0' && ramp >= 0.0f;
+            if (ok) settings->speedRamp = ramp;
+        } else if (strcmp(name, "min_obstacle_spacing") == 0) {
+            ok = parseSpacing(value, MIN_PLAYABLE_SPACING, &settings->minObstacleSpacing);
+        } else if (strcmp(name, "rand_obstacle_spacing") == 0) {
+            ok = parseSpacing(value, 0, &settings->randObstacleSpacing);
+        } else if (strcmp(name, "min_trash_bin_spacing") == 0) {
+            ok = parseSpacing(value, MIN_PLAYABLE_SPACING, &settings->minTrashBinSpacing);
+        } else if (strcmp(name, "rand_trash_bin_spacing") == 0) {
+            ok = parseSpacing(value, 0, &settings->randTrashBinSpacing);
+        } else {
+            printf("%s:%d: parametro desconhecido '%s' ignorado.\n", path, lineNumber, name);
+            continue;
+        }
+        if (!ok) printf("%s:%d: valor invalido '%s' para '%s' ignorado.\n", path, lineNumber, value, name);
+    }
+    fclose(file);
+    return 1;
+}
+
+int saveDifficultyPreset(const char* path, const DifficultySettings_s* settings, const char* comment) {
+    FILE* file = fopen(path, "w");
+    if (!file) return 0;
+    fprintf(file, "# EcoRunner - preset de dificuldade\n");
+    if (comment) fprintf(file, "# %s\n", comment);
+    fprintf(file, "speed_ramp = %.9g\n", settings->speedRamp);
+    fprintf(file, "min_obstacle_spacing = %d\n", settings->minObstacleSpacing);
+    fprintf(file, "rand_obstacle_spacing = %d\n", settings->randObstacleSpacing);
+    fprintf(file, "min_trash_bin_spacing = %d\n", settings->minTrashBinSpacing);
+    fprintf(file, "rand_trash_bin_spacing = %d\n", settings->randTrashBinSpacing);
+    return fclose(file) == 0;
+}
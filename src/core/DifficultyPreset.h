@@ -0,0 +1,25 @@
+#ifndef DIFFICULTYPRESET_H
+#define DIFFICULTYPRESET_H
+
+#include "World.h"
+
+// --- Preset de Dificuldade ---
+// Arquivo de texto com os parâmetros de DifficultySettings_s, um por linha, no formato "nome = valor".
+// Linhas vazias e começando com '#' são ignoradas; parâmetros ausentes mantêm o valor recebido.
+// É gerado pelo ajuste automático (ecorunner-tune) e lido pela janela ao iniciar (DIFFICULTY_PRESET_FILE).
+//
+//   # comentário
+//   speed_ramp = 0.000015
+//   min_obstacle_spacing = 450
+//   rand_obstacle_spacing = 300
+//   min_trash_bin_spacing = 400
+//   rand_trash_bin_spacing = 250
+
+// Lê o preset sobre 'settings'. Devolve 0 se o arquivo não pôde ser aberto (nada muda).
+// Nomes desconhecidos e valores inválidos são avisados no console e ignorados (inclusive espaçamentos
+// mínimos menores que MIN_PLAYABLE_SPACING, em que o jogo fica impossível).
+int loadDifficultyPreset(const char* path, DifficultySettings_s* settings);
+// Grava o preset, com 'comment' (pode ser NULL) como primeira linha de comentário. Devolve 0 se falhar.
+int saveDifficultyPreset(const char* path, const DifficultySettings_s* settings, const char* comment);
+
+#endif // DIFFICULTYPRESET_H
@@ -0,0 +1,548 @@
+#include "GameLogic.h"
+#include "World.h"
+#include "Config.h"
+#include "Player.h"
+#include "SimdKernels.h"
+#include "ScrollQueue.h"
+#include "ThrownTrash.h"
+#include "Random.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+#include <limits.h>
+
+/**
+ * Define a semente do gerador aleatório. A primeira partida iniciada depois disso é a partida 0,
+ * a seguinte a partida 1, e assim por diante: cada uma tem a sua fase, sempre a mesma para a semente.
+ */
+void setGameSeed(GameWorld_s* world, unsigned long long seed) {
+    world->gameSeed = seed;
+    world->matchIndex = -1;
+}
+
+// Bloco de números aleatórios do sorteio 'index' de um fluxo, na partida atual.
+static RandomBlock_s drawAt(const GameWorld_s* world, RandomStream stream, long long index) {
+    return randomBlock(world->gameSeed, world->matchIndex, stream, index);
+}
+
+ObstacleType obstacleTypeAt(const GameWorld_s* world, long long n) {
+    return (ObstacleType)randomBelow(drawAt(world, RNG_STREAM_OBSTACLE, n).word[0], OBSTACLE_TYPE_COUNT);
+}
+
+int obstacleGapAt(const GameWorld_s* world, long long n) {
+    return world->difficulty.minObstacleSpacing + randomBelow(drawAt(world, RNG_STREAM_OBSTACLE, n).word[1], world->difficulty.randObstacleSpacing);
+}
+
+int trashBinGapAt(const GameWorld_s* world, long long n) {
+    return world->difficulty.minTrashBinSpacing + randomBelow(drawAt(world, RNG_STREAM_TRASHBIN, n).word[0], world->difficulty.randTrashBinSpacing);
+}
+
+/**
+ * Prepara o jogo para uma nova partida, resetando todos os estados e posições.
+ * É chamada no início do jogo ou após um "Game Over".
+ */
+void initGame(GameWorld_s* world) {
+    // Reseta a posição e estado do jogador para os valores iniciais.
+    initPlayer(world);
+
+    // Nova partida: os sorteios recomeçam do índice 0, em um contador novo (ver Random.h).
+    world->matchIndex++;
+    memset(&world->spawnCounters, 0, sizeof(world->spawnCounters));
+
+    // --- GERAÇÃO PROCEDURAL INICIAL DE OBJETOS ---
+    float lastObjectX = world->viewWidth + 100;
+
+    // Esvazia os pools da partida anterior (a memória já alocada é reaproveitada).
+    poolClear(&world->trashBins);
+    poolClear(&world->obstacles);
+    poolClear(&world->thrownTrashItems);
+    poolReserve(&world->thrownTrashItems, TRASH_ITEM_POOL_CAPACITY);
+    scrollQueueClear(&world->trashBinQueue);
+    scrollQueueClear(&world->obstacleQueue);
+    world->nextThrownTrashEvent = LLONG_MAX;
+    // A previsão da rolagem da partida anterior não vale mais: a dificuldade pode ter mudado
+    // antes desta partida, e o tempo de jogo recomeça com a mesma velocidade inicial.
+    world->forecast.count = 0;
+
+    // Itera para criar e posicionar cada tipo de lixeira.
+    for (int t = 0; t < TRASH_TYPE_COUNT; t++) {
+        int i = poolSpawn(&world->trashBins);
+        world->trashBins.type[i] = (TrashType)t; // Define o tipo da lixeira (PAPEL, VIDRO, etc.).
+        world->trashBins.width[i] = 70;
+        world->trashBins.height[i] = 90;
+        // Calcula a posição X com um espaçamento mínimo e um valor aleatório adicional.
+        world->trashBins.x[i] = lastObjectX + trashBinGapAt(world, world->spawnCounters.trashBins++);
+        world->trashBins.y[i] = GROUND_LEVEL; // Todas as lixeiras ficam no nível do chão.
+        world->trashBins.prevX[i] = world->trashBins.x[i]; world->trashBins.prevY[i] = world->trashBins.y[i];
+        // Atualiza a referência da posição do último objeto.
+        lastObjectX = world->trashBins.x[i] + world->trashBins.width[i];
+        // As lixeiras são criadas da esquerda para a direita, já na ordem da fila.
+        scrollQueuePushBack(&world->trashBinQueue, poolHandleAt(&world->trashBins, i), lastObjectX);
+    }
+
+    lastObjectX += 150; // Adiciona um espaço extra entre o último objeto e o primeiro obstáculo.
+    // Itera para criar e posicionar os obstáculos iniciais.
+    for (int n = 0; n < OBSTACLE_WAVE_SIZE; n++) {
+        int i = poolSpawn(&world->obstacles); // Cria o obstáculo no pool.
+        long long spawn = world->spawnCounters.obstacles++; // O tipo e o espaçamento saem do mesmo sorteio.
+        // Escolhe um tipo de obstáculo aleatório da lista definida no enum 'ObstacleType'.
+        world->obstacles.type[i] = obstacleTypeAt(world, spawn);
+
+        // Usa uma estrutura switch, que é mais limpa e legível do que múltiplos 'if/else if',
+        // para configurar as propriedades específicas de cada tipo de obstáculo.
+        switch (world->obstacles.type[i]) {
+            case HOLE:
+                world->obstacles.width[i] = 90; world->obstacles.height[i] = 20; 
+                world->obstacles.y[i] = GROUND_LEVEL - 10; // Fica um pouco abaixo do chão.
+                break;
+            case DOG:
+                world->obstacles.width[i] = 70; world->obstacles.height[i] = 50;
+                world->obstacles.y[i] = GROUND_LEVEL;
+                break;
+            case BIKE:
+                world->obstacles.width[i] = 80; world->obstacles.height[i] = 70;
+                world->obstacles.y[i] = GROUND_LEVEL;
+                break;
+            case MONSTER:
+                world->obstacles.width[i] = 75; 
+                world->obstacles.height[i] = 90;
+                world->obstacles.y[i] = GROUND_LEVEL;
+                break;
+            case FLYING_MONSTER:
+                world->obstacles.width[i] = 60;
+                world->obstacles.height[i] = 60;
+                // Posicionado mais alto para que o jogador precise se agachar.
+                world->obstacles.y[i] = GROUND_LEVEL + (PLAYER_HEIGHT / 1.5f);
+                break;
+        }
+        // Após definir as propriedades, calcula a posição X do obstáculo.
+        world->obstacles.x[i] = lastObjectX + obstacleGapAt(world, spawn);
+        world->obstacles.prevX[i] = world->obstacles.x[i]; world->obstacles.prevY[i] = world->obstacles.y[i];
+        lastObjectX = world->obstacles.x[i] + world->obstacles.width[i];
+        scrollQueuePushBack(&world->obstacleQueue, poolHandleAt(&world->obstacles, i), lastObjectX);
+    }
+
+    // --- RESET DE VARIÁVEIS DA PARTIDA ---
+    // Zera ou redefine todas as variáveis de controle do jogo.
+    world->score = 0;
+    world->lives = 3;
+    world->nextLifeScore = 2000; // Marco de pontuação para ganhar a primeira vida extra.
+    world->currentObstacleSpeed = OBSTACLE_SPEED_BASE;
+    world->gameTime = 0.0f;
+    world->simTick = 0;
+    world->backgroundOffset1 = 0.0f; // Reseta a posição do fundo.
+    world->backgroundOffset2 = world->viewWidth;
+    world->prevBackgroundOffset1 = world->backgroundOffset1;
+    world->prevBackgroundOffset2 = world->backgroundOffset2;
+
+    // Finalmente, muda o estado do jogo para "PLAYING". Isso "liga" o motor do jogo.
+    world->gameState = PLAYING;
+}
+
+/**
+ * Guarda a posição atual de tudo que se move, antes de um novo passo.
+ * Como a simulação anda em passos fixos e a tela pode ser desenhada com qualquer frequência,
+ * o Renderer desenha cada objeto entre a posição anterior e a atual (interpolação).
+ */
+static void storePreviousPositions(GameWorld_s* world) {
+    world->player.prevX = world->player.x;
+    world->player.prevY = world->player.y;
+    // O lixo arremessado não entra aqui: sua posição sai direto da trajetória (ver ThrownTrash.h).
+    // Com a estrutura de arrays, guardar as posições é só copiar colunas inteiras.
+    memcpy(world->obstacles.prevX, world->obstacles.x, sizeof(float) * world->obstacles.count);
+    memcpy(world->obstacles.prevY, world->obstacles.y, sizeof(float) * world->obstacles.count);
+    memcpy(world->trashBins.prevX, world->trashBins.x, sizeof(float) * world->trashBins.count);
+    memcpy(world->trashBins.prevY, world->trashBins.y, sizeof(float) * world->trashBins.count);
+    world->prevBackgroundOffset1 = world->backgroundOffset1;
+    world->prevBackgroundOffset2 = world->backgroundOffset2;
+}
+
+/**
+ * A parte do passo que não depende de eventos: relógio, jogador, rolagem do cenário,
+ * aumento da velocidade e fundo. Nada aqui sorteia números ou testa colisões, então
+ * os passos sem eventos podem ser avançados só com esta função (ver skipTicks).
+ * As colunas x dos obstáculos e lixeiras ficam de fora: quem chama as desloca com
+ * a velocidade de antes da chamada (um passo por vez em step, em lote em skipTicks).
+ */
+static void advanceClock(GameWorld_s* world) {
+    world->simTick++;
+
+    // Acumula o tempo de jogo, usado para aumentar a dificuldade.
+    world->gameTime += SIM_TICK_SECONDS;
+    // Chama a função que atualiza a física do pulo e a animação de corrida do jogador.
+    updatePlayerAnimation(world);
+
+    // Calcula um multiplicador de velocidade para o fundo, criando um efeito de parallax.
+    float speedMultiplier = world->currentObstacleSpeed / OBSTACLE_SPEED_BASE;
+
+    // --- MOVIMENTO DE OBSTÁCULOS E LIXEIRAS ---
+    // A borda direita de cada fila acompanha a rolagem dos objetos.
+    // Lixeiras se movem um pouco mais devagar que os obstáculos para dar variedade.
+    scrollQueueAdvance(&world->obstacleQueue, world->currentObstacleSpeed);
+    scrollQueueAdvance(&world->trashBinQueue, world->currentObstacleSpeed * 0.90f);
+    // Aumenta a dificuldade do jogo gradualmente, tornando-o mais rápido com o tempo.
+    // Fica logo após a rolagem: daqui em diante 'currentObstacleSpeed' já é a velocidade do
+    // próximo passo, que é o que a previsão do lixo arremessado espera (ver ThrownTrash.cpp).
+    world->currentObstacleSpeed += world->gameTime * world->difficulty.speedRamp;
+
+    // --- MOVIMENTO DO FUNDO (PARALLAX SCROLLING) ---
+    // Move as duas imagens de fundo para a esquerda.
+    world->backgroundOffset1 -= 2.0f * speedMultiplier;
+    world->backgroundOffset2 -= 2.0f * speedMultiplier;
+    // Quando uma imagem sai completamente da tela, ela é reposicionada à direita da outra,
+    // criando a ilusão de um fundo infinito.
+    // O valor "anterior" acompanha o salto, para que a interpolação continue suave.
+    if (world->backgroundOffset1 <= -world->viewWidth) {
+        world->backgroundOffset1 = world->backgroundOffset2 + world->viewWidth;
+        world->prevBackgroundOffset1 = world->backgroundOffset1 + 2.0f * speedMultiplier;
+    }
+    if (world->backgroundOffset2 <= -world->viewWidth) {
+        world->backgroundOffset2 = world->backgroundOffset1 + world->viewWidth;
+        world->prevBackgroundOffset2 = world->backgroundOffset2 + 2.0f * speedMultiplier;
+    }
+}
+
+/**
+ * O motor do jogo: avança a simulação em exatamente um passo (tick).
+ * Não depende de GLUT: na janela é chamado pelo timer (ver GameLoop.cpp, ~60 vezes por segundo);
+ * no simulador (ecorunner-sim) é chamado em um laço, tão rápido quanto a CPU permitir.
+ */
+void step(GameWorld_s* world) {
+    // A lógica do jogo só é executada se o estado for "PLAYING".
+    if (world->gameState == PLAYING) {
+        // Guarda as posições do passo anterior para a interpolação do desenho.
+        storePreviousPositions(world);
+        // Move todos os obstáculos e lixeiras para a esquerda com base na velocidade atual do jogo.
+        // O kernel vetorizado atualiza vários objetos por instrução (ver SimdKernels.cpp).
+        scrollEntities(world->obstacles.x, world->obstacles.count, world->currentObstacleSpeed);
+        scrollEntities(world->trashBins.x, world->trashBins.count, world->currentObstacleSpeed * 0.90f);
+        // Relógio, jogador, filas de rolagem, velocidade e fundo.
+        advanceClock(world);
+        // --- REPOSICIONAMENTO DE OBSTÁCULOS ---
+        // Como todos andam na mesma velocidade, a fila está em ordem de X: basta olhar o início.
+        // Cada obstáculo que saiu da tela vai para o fim da fila, atrás do mais à direita (O(1)).
+        while (world->obstacleQueue.count > 0) {
+            int i = poolIndexOf(&world->obstacles, scrollQueueFront(&world->obstacleQueue));
+            // Handle de um monstro destruído: apenas descarta.
+            if (i < 0) { scrollQueuePopFront(&world->obstacleQueue); continue; }
+            // O primeiro da fila ainda está na tela, então todos os outros também estão.
+            if (world->obstacles.x[i] >= -world->obstacles.width[i] - 200) break;
+
+            // ...é hora de reposicioná-lo na frente.
+            // A base para o novo posicionamento é a borda da tela ou o fim da fila, o que for maior.
+            float spawn_base_x = fmax((float)world->viewWidth, world->obstacleQueue.tailRight);
+            long long spawn = world->spawnCounters.obstacles++;
+            // Calcula a nova posição X com um espaçamento mínimo e um fator aleatório.
+            world->obstacles.x[i] = spawn_base_x + obstacleGapAt(world, spawn);
+
+            // --- LÓGICA DE RE-SORTEIO ---
+            // Ao reposicionar um obstáculo, seu tipo e propriedades são sorteados novamente.
+            // Isso aumenta a variedade e torna o jogo menos repetitivo.
+            world->obstacles.type[i] = obstacleTypeAt(world, spawn);
+            if (world->obstacles.type[i] == HOLE) {
+                world->obstacles.width[i] = 90; world->obstacles.height[i] = 20;
+                world->obstacles.y[i] = GROUND_LEVEL - 10;
+            } else if (world->obstacles.type[i] == DOG){
+                world->obstacles.width[i] = 70; world->obstacles.height[i] = 50;
+                world->obstacles.y[i] = GROUND_LEVEL;
+            } else if (world->obstacles.type[i] == BIKE) {
+                world->obstacles.width[i] = 80; world->obstacles.height[i] = 100;
+                world->obstacles.y[i] = GROUND_LEVEL;
+            } else if (world->obstacles.type[i] == MONSTER) {
+                world->obstacles.width[i] = 75;
+                world->obstacles.height[i] = 90;
+                world->obstacles.y[i] = GROUND_LEVEL;
+            } else if (world->obstacles.type[i] == FLYING_MONSTER) {
+                world->obstacles.width[i] = 60;
+                world->obstacles.height[i] = 60;
+                world->obstacles.y[i] = GROUND_LEVEL + (PLAYER_HEIGHT / 1.5f);
+            }
+            // O obstáculo foi "teletransportado": não há o que interpolar.
+            world->obstacles.prevX[i] = world->obstacles.x[i];
+            world->obstacles.prevY[i] = world->obstacles.y[i];
+
+            scrollQueuePopFront(&world->obstacleQueue);
+            scrollQueuePushBack(&world->obstacleQueue, poolHandleAt(&world->obstacles, i), world->obstacles.x[i] + world->obstacles.width[i]);
+            thrownTrashObstacleAdded(world, i); // O lixo no ar pode atingir o obstáculo novo.
+        }
+
+        // --- REPOSICIONAMENTO DE LIXEIRAS ---
+        // Lógica de reposicionamento similar à dos obstáculos, com a fila própria das lixeiras.
+        while (world->trashBinQueue.count > 0) {
+            int i = poolIndexOf(&world->trashBins, scrollQueueFront(&world->trashBinQueue));
+            if (i < 0) { scrollQueuePopFront(&world->trashBinQueue); continue; }
+            if (world->trashBins.x[i] >= -world->trashBins.width[i] - 150) break;
+
+            world->trashBins.x[i] = fmax((float)world->viewWidth, world->trashBinQueue.tailRight) + trashBinGapAt(world, world->spawnCounters.trashBins++);
+            world->trashBins.prevX[i] = world->trashBins.x[i];
+
+            scrollQueuePopFront(&world->trashBinQueue);
+            scrollQueuePushBack(&world->trashBinQueue, poolHandleAt(&world->trashBins, i), world->trashBins.x[i] + world->trashBins.width[i]);
+            thrownTrashBinAdded(world, i);
+        }
+
+        // --- MOVIMENTO DOS LIXOS ARREMESSADOS ---
+        // Nada a fazer por passo: a posição do lixo é calculada pela trajetória em forma fechada,
+        // e o acerto (ou a saída da tela) já tem passo marcado (ver ThrownTrash.h e checkAllCollisions).
+
+        // --- ATUALIZAÇÕES FINAIS DA PARTIDA ---
+        // Chama a função que verifica todas as colisões.
+        checkAllCollisions(world);
+        // Verifica se as vidas do jogador acabaram para encerrar o jogo.
+        if (world->lives <= 0) world->gameState = GAME_OVER;
+    }
+}
+
+/**
+ * Quantos pixels os obstáculos ainda podem rolar sem que nada além do movimento aconteça:
+ * nenhum obstáculo ou lixeira sai da tela (reciclagem) e nenhum obstáculo alcança o jogador.
+ * Devolve 0 quando um evento pode acontecer já no próximo passo.
+ */
+static float eventFreeDistance(const GameWorld_s* world) {
+    // Margem para os arredondamentos de float acumulados nas posições durante o salto.
+    const float margin = 2.0f;
+    float distance = 1e30f;
+
+    // Reciclagem: o primeiro de cada fila é o que sai da tela primeiro.
+    // As lixeiras rolam a 90% da velocidade dos obstáculos, então a mesma medida as cobre com folga.
+    if (world->obstacleQueue.count > 0) {
+        int i = poolIndexOf(&world->obstacles, scrollQueueFront(&world->obstacleQueue));
+        if (i < 0) return 0.0f; // Handle descartado: quem trata é o passo completo.
+        distance = fmin(distance, world->obstacles.x[i] + world->obstacles.width[i] + 200);
+    }
+    if (world->trashBinQueue.count > 0) {
+        int i = poolIndexOf(&world->trashBins, scrollQueueFront(&world->trashBinQueue));
+        if (i < 0) return 0.0f;
+        distance = fmin(distance, world->trashBins.x[i] + world->trashBins.width[i] + 150);
+    }
+
+    // Colisão com o jogador (mesma caixa de checkAllCollisions). O jogador não anda na horizontal.
+    float pHeight = world->player.ducking ? world->player.height / 1.8f : world->player.height;
+    float playerTop = world->player.y + pHeight, playerBottom = world->player.y;
+    float playerLeft = world->player.x, playerRight = world->player.x + world->player.width;
+    for (int i = 0; i < world->obstacles.count; i++) {
+        float obsLeft = world->obstacles.x[i], obsRight = world->obstacles.x[i] + world->obstacles.width[i];
+        if (obsRight <= playerLeft) continue; // Já passou pelo jogador: não o atinge mais.
+        if (obsLeft >= playerRight) {         // Ainda vai chegar.
+            distance = fmin(distance, obsLeft - playerRight);
+            continue;
+        }
+        // Está passando pelo jogador. Só é seguro se a altura do jogador não mudar (sem pulo)
+        // e as caixas não se sobrepuserem na vertical agora.
+        if (world->player.jumping) return 0.0f;
+        if (playerTop > world->obstacles.y[i] && playerBottom < world->obstacles.y[i] + world->obstacles.height[i]) return 0.0f;
+    }
+    return distance > margin ? distance - margin : 0.0f;
+}
+
+/**
+ * Avança até 'maxTicks' passos sem entrada do jogador, com o mesmo resultado de chamar step()
+ * 'maxTicks' vezes. Os trechos sem eventos (reciclagem, colisão com o jogador, evento de lixo
+ * arremessado) andam só com advanceClock, sem guardar posições anteriores nem testar colisões;
+ * as velocidades de cada passo são guardadas e as colunas x são deslocadas em lote no fim do trecho.
+ * Os passos em que algo pode acontecer (e sempre o último) são passos completos.
+ * Para antes se a partida acabar. Devolve quantos passos foram simulados.
+ */
+#define SKIP_BATCH 256
+long long skipTicks(GameWorld_s* world, long long maxTicks) {
+    float obstacleDx[SKIP_BATCH], binDx[SKIP_BATCH];
+    long long done = 0;
+    while (done < maxTicks && world->gameState == PLAYING) {
+        // O último passo é completo, para que as posições anteriores (interpolação) fiquem certas.
+        long long quiet = maxTicks - done - 1;
+        // O passo do evento do lixo é tratado por checkAllCollisions, então também é completo.
+        if (world->nextThrownTrashEvent - world->simTick - 1 < quiet) quiet = world->nextThrownTrashEvent - world->simTick - 1;
+
+        // A distância livre vale para a soma das velocidades dos passos pulados.
+        float budget = eventFreeDistance(world);
+        float scrolled = 0.0f;
+        while (quiet > 0 && scrolled + world->currentObstacleSpeed <= budget) {
+            int n = 0;
+            while (n < SKIP_BATCH && n < quiet && scrolled + world->currentObstacleSpeed <= budget) {
+                scrolled += world->currentObstacleSpeed;
+                obstacleDx[n] = world->currentObstacleSpeed;
+                binDx[n] = world->currentObstacleSpeed * 0.90f;
+                advanceClock(world);
+                n++;
+            }
+            scrollEntitiesSeries(world->obstacles.x, world->obstacles.count, obstacleDx, n);
+            scrollEntitiesSeries(world->trashBins.x, world->trashBins.count, binDx, n);
+            quiet -= n;
+            done += n;
+        }
+
+        step(world);
+        done++;
+    }
+    return done;
+}
+
+/**
+ * Verifica colisões entre o jogador, obstáculos, lixos arremessados e lixeiras.
+ */
+void checkAllCollisions(GameWorld_s* world) {
+    // Define a "hitbox" (caixa de colisão) do jogador.
+    float pHeight = world->player.ducking ? world->player.height / 1.8f : world->player.height;
+    float playerTop = world->player.y + pHeight, playerBottom = world->player.y;
+    float playerLeft = world->player.x, playerRight = world->player.x + world->player.width;
+
+    // --- Colisão: Jogador vs. Obstáculos ---
+    for (int i = 0; i < world->obstacles.count; i++) {
+        float obsTop = world->obstacles.y[i] + world->obstacles.height[i], obsBottom = world->obstacles.y[i];
+        float obsLeft = world->obstacles.x[i], obsRight = world->obstacles.x[i] + world->obstacles.width[i];
+        
+        // Verifica se as caixas de colisão do jogador e do obstáculo se sobrepõem.
+        if (playerRight > obsLeft && playerLeft < obsRight && playerTop > obsBottom && playerBottom < obsTop) {
+            world->lives--; // Perde uma vida.
+            // Joga o obstáculo para longe: ele vai para o fim da fila de rolagem, para que a fila
+            // continue em ordem de X. O handle antigo fica inválido e é descartado pela fila.
+            ObstacleType type = world->obstacles.type[i];
+            float width = world->obstacles.width[i], height = world->obstacles.height[i], y = world->obstacles.y[i];
+            poolDespawn(&world->obstacles, i);
+            int k = poolSpawn(&world->obstacles);
+            world->obstacles.type[k] = type;
+            world->obstacles.width[k] = width; world->obstacles.height[k] = height;
+            world->obstacles.y[k] = y;
+            world->obstacles.x[k] = fmax((float)world->viewWidth + 250, world->obstacleQueue.tailRight + world->difficulty.minObstacleSpacing)
+                           + randomBelow(drawAt(world, RNG_STREAM_RELOCATION, world->spawnCounters.relocations++).word[0], 200);
+            world->obstacles.prevX[k] = world->obstacles.x[k]; world->obstacles.prevY[k] = world->obstacles.y[k];
+            scrollQueuePushBack(&world->obstacleQueue, poolHandleAt(&world->obstacles, k), world->obstacles.x[k] + world->obstacles.width[k]);
+            // O obstáculo sumiu de onde estava: recalcula o lixo no ar, sem acertos neste passo.
+            rescheduleAllThrownTrash(world, 0);
+            if (world->lives <= 0) world->gameState = GAME_OVER;
+            // Sai do laço para evitar que o jogador perca múltiplas vidas em um único quadro.
+            break;
+        }
+    }
+    
+    // --- Colisão: Lixo Arremessado vs. Outros Objetos ---
+    if (world->thrownTrashItems.count == 0) return;
+    // Se o jogador foi atingido neste passo, os eventos já foram recalculados sem acertos
+    // neste passo (como antes, quando a função retornava antes de testar o lixo).
+    // Na grande maioria dos passos nenhum item tem evento marcado: não há o que testar.
+    if (world->simTick < world->nextThrownTrashEvent) return;
+
+    // Trata os itens cujo evento chegou, na mesma ordem da antiga simulação passo a passo.
+    // 1. Primeiro os que saíram da tela, que retornam para o "pool" de objetos (antes, a remoção
+    // acontecia no movimento, antes das colisões). Um item removido é substituído pelo último,
+    // então o índice só avança quando o item continua voando.
+    for (int i = 0; i < world->thrownTrashItems.count; ) {
+        if (world->thrownTrashItems.eventTick[i] <= world->simTick) {
+            updateThrownTrashPosition(world, i);
+            if (world->thrownTrashItems.y[i] < -50 || world->thrownTrashItems.x[i] > world->viewWidth + 50) {
+                poolDespawn(&world->thrownTrashItems, i);
+                continue;
+            }
+        }
+        i++;
+    }
+    // 2. Depois os acertos. Todos os itens com evento são testados nas posições atuais, na ordem
+    // do pool, e só então os acertos são aplicados, na mesma ordem: um monstro destruído por um
+    // item não muda o que os outros itens atingiram neste passo.
+    ThrownTrashHits_s* hits = &world->thrownTrashHits;
+    if (hits->capacity < world->thrownTrashItems.count) {
+        hits->capacity = world->thrownTrashItems.capacity;
+        hits->items = (PoolHandle_s*)realloc(hits->items, sizeof(PoolHandle_s) * hits->capacity);
+        hits->monsters = (PoolHandle_s*)realloc(hits->monsters, sizeof(PoolHandle_s) * hits->capacity);
+        hits->bins = (int*)realloc(hits->bins, sizeof(int) * hits->capacity);
+    }
+    int hitCount = 0;
+    for (int i = 0; i < world->thrownTrashItems.count; i++) {
+        if (world->thrownTrashItems.eventTick[i] > world->simTick) continue;
+        int k, j;
+        if (!findThrownTrashHit(world, i, &k, &j)) {
+            // A previsão não se confirmou (não deveria acontecer): recalcula a partir do próximo passo.
+            scheduleThrownTrash(world, i, 0);
+            continue;
+        }
+        hits->items[hitCount] = poolHandleAt(&world->thrownTrashItems, i);
+        hits->monsters[hitCount].slot = -1; hits->monsters[hitCount].generation = 0;
+        if (k >= 0) hits->monsters[hitCount] = poolHandleAt(&world->obstacles, k);
+        hits->bins[hitCount] = j;
+        hitCount++;
+    }
+
+    int monsterKilled = 0;
+    for (int h = 0; h < hitCount; h++) {
+        int i = poolIndexOf(&world->thrownTrashItems, hits->items[h]);
+        // vs. Monstros (têm prioridade sobre as lixeiras).
+        // Se outro item já destruiu o monstro neste passo, o handle está inválido.
+        int k = poolIndexOf(&world->obstacles, hits->monsters[h]);
+        if (k >= 0) {
+            if (world->thrownTrashItems.type[i] == METAL) { // Apenas lixo de METAL destrói monstros.
+                world->score += 30;
+                poolDespawn(&world->obstacles, k); // "Mata" o monstro.
+                monsterKilled = 1;
+            }
+            poolDespawn(&world->thrownTrashItems, i); // Remove o projétil.
+            continue;
+        }
+        // vs. Lixeiras
+        int j = hits->bins[h];
+        if (j < 0) continue; // Só tinha acertado um monstro que já foi destruído: segue voando.
+        if (world->thrownTrashItems.type[i] == world->trashBins.type[j]) { // Acertou a lixeira correta.
+            world->score += 10;
+            if (world->score >= world->nextLifeScore) { // Verifica se ganhou vida extra.
+                if (world->lives < 3) { // Só ganha se não tiver o máximo de vidas.
+                    world->lives++;
+                    if (world->logMessages) printf("Vida extra! Total de vidas: %d\n", world->lives);
+                } else if (world->logMessages) {
+                    printf("Pontuacao para vida extra alcancada, mas vidas ja estao no maximo!\n");
+                }
+                // Define o próximo marco, 2000 pontos a partir do marco atual.
+                world->nextLifeScore += 2000; 
+                if (world->logMessages) printf("Proxima vida extra em %d pontos.\n", world->nextLifeScore);
+            }
+        } else { // Errou a lixeira.
+            world->score -= 5;
+            if (world->score < 0) world->score = 0;
+        }
+        poolDespawn(&world->thrownTrashItems, i); // Remove o projétil.
+    }
+    // Outros itens podiam estar indo na direção de um monstro destruído (inclusive os que seguem
+    // voando): recalcula todos a partir do próximo passo, já que os acertos deste foram tratados.
+    if (monsterKilled) rescheduleAllThrownTrash(world, 0);
+
+    // O próximo passo com algum evento.
+    world->nextThrownTrashEvent = LLONG_MAX;
+    for (int i = 0; i < world->thrownTrashItems.count; i++) {
+        if (world->thrownTrashItems.eventTick[i] < world->nextThrownTrashEvent) world->nextThrownTrashEvent = world->thrownTrashItems.eventTick[i];
+    }
+}
+
+/**
+ * "Cria" um novo item de lixo arremessado usando a técnica de "object pooling".
+ * O pool entrega a próxima posição livre em O(1) e cresce se estiver cheio,
+ * então nenhum arremesso é descartado.
+ * O item começa a andar no próximo passo, pela trajetória em forma fechada (ver ThrownTrash.h).
+ */
+void spawnThrownTrashItem(GameWorld_s* world) {
+    int i = poolSpawn(&world->thrownTrashItems);
+    // Configura suas propriedades iniciais.
+    world->thrownTrashItems.width[i] = 25;
+    world->thrownTrashItems.height[i] = 25;
+    world->thrownTrashItems.x[i] = world->player.x + world->player.width; // Posição inicial perto do jogador.
+    world->thrownTrashItems.y[i] = world->player.y + (world->player.ducking ? world->player.height / 3.6f : world->player.height / 1.8f);
+    world->thrownTrashItems.type[i] = world->player.selectedTrash; // Usa o tipo de lixo que o jogador está segurando.
+    world->thrownTrashItems.velocityX[i] = TRASH_ITEM_SPEED_X;
+    world->thrownTrashItems.velocityY[i] = TRASH_ITEM_INITIAL_SPEED_Y;
+    world->thrownTrashItems.prevX[i] = world->thrownTrashItems.x[i]; // Acabou de nascer: sem interpolação.
+    world->thrownTrashItems.prevY[i] = world->thrownTrashItems.y[i];
+    // A trajetória parte daqui; o passo do acerto (ou da saída da tela) já é calculado agora.
+    world->thrownTrashItems.originX[i] = world->thrownTrashItems.x[i];
+    world->thrownTrashItems.originY[i] = world->thrownTrashItems.y[i];
+    world->thrownTrashItems.spawnTick[i] = world->simTick;
+    scheduleThrownTrash(world, i, 0);
+}
+
+/**
+ * Alterna o tipo de lixo que o jogador está segurando.
+ */
+void cycleSelectedTrash(GameWorld_s* world) {
+    int currentType = (int)world->player.selectedTrash;
+    // Usa o operador módulo (%) para ciclar pelos tipos de lixo.
+    // Quando chega ao fim da lista, ele volta para o primeiro tipo (0).
+    currentType = (currentType + 1) % TRASH_TYPE_COUNT;
+    world->player.selectedTrash = (TrashType)currentType;
+}
\ No newline at end of file
@@ -0,0 +1,22 @@
+#ifndef GAMELOGIC_H
+#define GAMELOGIC_H
+
+#include "World.h"
+
+// --- Protótipos de Funções ---
+// Funções que controlam as regras e o estado do jogo.
+
+void setGameSeed(GameWorld_s* world, unsigned long long seed); // Define a semente das próximas partidas (a mesma semente gera as mesmas fases).
+void initGame(GameWorld_s* world);              // Inicializa ou reinicia todo o estado de uma partida.
+void step(GameWorld_s* world);                  // Avança a lógica do jogo em um passo (movimento, colisões, etc.). Não usa GLUT.
+long long skipTicks(GameWorld_s* world, long long maxTicks); // Avança até maxTicks passos sem entrada, pulando os trechos sem eventos.
+void checkAllCollisions(GameWorld_s* world);    // Verifica todas as possíveis colisões entre os objetos do jogo.
+void spawnThrownTrashItem(GameWorld_s* world);  // Cria uma nova instância de lixo arremessado pelo jogador.
+void cycleSelectedTrash(GameWorld_s* world);    // Alterna o tipo de lixo que o jogador está segurando.
+
+// Sorteios da partida atual, em O(1) para qualquer N (não consomem nada; ver Random.h).
+ObstacleType obstacleTypeAt(const GameWorld_s* world, long long n); // Tipo do N-ésimo obstáculo posicionado.
+int obstacleGapAt(const GameWorld_s* world, long long n);           // Espaço antes do N-ésimo obstáculo.
+int trashBinGapAt(const GameWorld_s* world, long long n);           // Espaço antes da N-ésima lixeira.
+
+#endif // GAMELOGIC_H
\ No newline at end of file
@@ -0,0 +1,139 @@
+#include "Planner.h"
+#include "AutoPlayer.h"
+#include "GameLogic.h"
+#include "Player.h"
+#include <stdlib.h>
+#include <chrono>
+
+// Peso de cada vida na avaliação: uma vida vale mais do que qualquer pontuação da janela da busca.
+#define PLANNER_LIFE_VALUE 100000.0
+
+/**
+ * Aplica o movimento ao jogador, como as teclas fariam.
+ */
+static void applyMove(GameWorld_s* world, int move) {
+    if (move == PLANNER_DUCK) {
+        playerSetDucking(world, 1);
+        return;
+    }
+    if (world->player.ducking) playerSetDucking(world, 0);
+    if (move == PLANNER_JUMP) playerJump(world);
+}
+
+/**
+ * Avaliação de um estado: perder a partida é o pior resultado; depois vêm as vidas e os pontos.
+ */
+static double evaluate(const GameWorld_s* world) {
+    if (world->gameState != PLAYING) return -1e18 + (double)world->simTick; // Quanto mais tarde, menos pior.
+    return world->lives * PLANNER_LIFE_VALUE + world->score;
+}
+
+/**
+ * Simula o movimento a partir do estado 'parent' e guarda o resultado em 'child'.
+ * Devolve 0 se o estado não coube em um retrato.
+ */
+static int expand(Planner_s* planner, const WorldSnapshot_s* parent, int move, PlannerNode_s* child) {
+    GameWorld_s* world = &planner->scratch;
+    restoreWorldSnapshot(world, parent);
+    applyMove(world, move);
+    for (int t = 0; t < planner->ticksPerMove && world->gameState == PLAYING; t++) step(world);
+    planner->nodesExpanded++;
+    child->value = evaluate(world);
+    return saveWorldSnapshot(world, &child->state);
+}
+
+// Os movimentos que fazem diferença a partir do estado: no ar não dá para pular nem agachar.
+static int movesFrom(const WorldSnapshot_s* state) {
+    return state->player.jumping ? 1 : PLANNER_MOVE_COUNT;
+}
+
+/**
+ * Ordena os índices dos estados do nível pela avaliação, do maior para o menor (ordenação por
+ * inserção: o nível tem no máximo beamWidth * PLANNER_MOVE_COUNT estados). Empates ficam na ordem
+ * de criação, então correr vem antes de pular e de agachar.
+ */
+static void sortLevel(const PlannerNode_s* level, int* order, int count) {
+    for (int i = 0; i < count; i++) {
+        int index = i, n = i;
+        while (n > 0 && level[order[n - 1]].value < level[index].value) {
+            order[n] = order[n - 1];
+            n--;
+        }
+        order[n] = index;
+    }
+}
+
+Planner_s* plannerCreate(int beamWidth, int depth, int ticksPerMove, double budgetSeconds) {
+    Planner_s* planner = (Planner_s*)calloc(1, sizeof(Planner_s));
+    planner->beamWidth = beamWidth > 0 ? beamWidth : 1;
+    planner->depth = depth > 0 ? depth : 1;
+    planner->ticksPerMove = ticksPerMove > 0 ? ticksPerMove : 1;
+    planner->budgetSeconds = budgetSeconds;
+    int levelSize = planner->beamWidth * PLANNER_MOVE_COUNT;
+    planner->levels[0] = (PlannerNode_s*)malloc(sizeof(PlannerNode_s) * (size_t)levelSize);
+    planner->levels[1] = (PlannerNode_s*)malloc(sizeof(PlannerNode_s) * (size_t)levelSize);
+    planner->order = (int*)malloc(sizeof(int) * (size_t)levelSize);
+    initWorld(&planner->scratch);
+    planner->scratch.logMessages = 0;
+    return planner;
+}
+
+void plannerDestroy(Planner_s* planner) {
+    free(planner->levels[0]);
+    free(planner->levels[1]);
+    free(planner->order);
+    freeWorld(&planner->scratch);
+    free(planner);
+}
+
+void plannerAct(Planner_s* planner, GameWorld_s* world) {
+    if (world->gameState != PLAYING) return;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point deadline =
+        start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(planner->budgetSeconds));
+
+    // O estado atual é a raiz (nível 0, um único estado).
+    PlannerNode_s* current = planner->levels[0];
+    PlannerNode_s* next = planner->levels[1];
+    if (!saveWorldSnapshot(world, &current[0].state)) {
+        autoPlayerAct(world); // Mundo grande demais para clonar: fica com o bot reativo.
+        return;
+    }
+    planner->plans++;
+    int currentCount = 1;
+    int bestMove = -1; // Primeiro movimento do melhor estado do último nível completo.
+
+    for (int level = 0; level < planner->depth; level++) {
+        int nextCount = 0, complete = 1;
+        for (int n = 0; n < currentCount && complete; n++) {
+            int parent = level == 0 ? 0 : planner->order[n];
+            int moves = movesFrom(&current[parent].state);
+            for (int move = 0; move < moves; move++) {
+                PlannerNode_s* child = &next[nextCount];
+                if (!expand(planner, &current[parent].state, move, child)) continue;
+                child->firstMove = level == 0 ? move : current[parent].firstMove;
+                nextCount++;
+            }
+            if (std::chrono::steady_clock::now() >= deadline) complete = 0;
+        }
+        if (!complete || nextCount == 0) {
+            planner->truncatedPlans++;
+            break;
+        }
+
+        // Ordena o nível e mantém só os melhores como pais do próximo.
+        sortLevel(next, planner->order, nextCount);
+        bestMove = next[planner->order[0]].firstMove;
+
+        PlannerNode_s* swap = current; current = next; next = swap;
+        currentCount = nextCount < planner->beamWidth ? nextCount : planner->beamWidth;
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    planner->planningSeconds += elapsed.count();
+
+    // Sem nenhum nível completo no tempo limite, o desvio fica com o bot reativo.
+    if (bestMove < 0) autoPlayerDodge(world);
+    else applyMove(world, bestMove);
+    autoPlayerThrow(world);
+}
@@ -0,0 +1,48 @@
+#ifndef PLANNER_H
+#define PLANNER_H
+
+#include "World.h"
+#include "Snapshot.h"
+
+// --- Planejador por Busca em Feixe (beam search) ---
+// Um bot que, em vez de reagir só ao próximo obstáculo, clona o mundo (Snapshot.h) e simula com
+// o próprio step() várias sequências de movimentos alguns segundos à frente:
+//  - cada nível da busca aplica um movimento (correr, pular ou agachar) por 'ticksPerMove' passos;
+//  - de todos os filhos do nível, ficam só os 'beamWidth' melhores (vivos, mais vidas, mais pontos);
+//  - o primeiro movimento da melhor sequência é o que o jogador faz agora.
+// A busca para no tempo limite do passo ('budgetSeconds'), usando o último nível completo.
+// O arremesso é o mesmo do bot reativo (autoPlayerThrow); nas simulações ninguém arremessa,
+// então os monstros são sempre tratados como obstáculos (uma escolha conservadora).
+
+// Movimentos que o planejador considera em cada nível.
+enum PlannerMove { PLANNER_RUN, PLANNER_JUMP, PLANNER_DUCK, PLANNER_MOVE_COUNT };
+
+// Um estado da busca: o mundo depois de uma sequência de movimentos.
+typedef struct {
+    WorldSnapshot_s state;
+    int firstMove;  // Primeiro movimento da sequência que levou até aqui.
+    double value;   // Avaliação do estado (maior é melhor).
+} PlannerNode_s;
+
+typedef struct {
+    int beamWidth;          // Estados mantidos por nível.
+    int depth;              // Níveis (movimentos) simulados à frente.
+    int ticksPerMove;       // Passos de cada movimento.
+    double budgetSeconds;   // Tempo máximo de cada plannerAct.
+    PlannerNode_s* levels[2]; // Dois níveis alternados, cada um com beamWidth * PLANNER_MOVE_COUNT estados.
+    int* order;             // Índices dos estados do nível, ordenados pela avaliação.
+    GameWorld_s scratch;    // Mundo de rascunho onde os estados são restaurados e avançados.
+    // Estatísticas acumuladas.
+    long long nodesExpanded;   // Estados simulados.
+    long long plans;           // Chamadas de plannerAct que planejaram.
+    long long truncatedPlans;  // Planos interrompidos pelo tempo limite antes da profundidade total.
+    double planningSeconds;    // Tempo total gasto planejando.
+} Planner_s;
+
+// Cria o planejador (e toda a memória da busca, alocada uma única vez).
+Planner_s* plannerCreate(int beamWidth, int depth, int ticksPerMove, double budgetSeconds);
+void plannerDestroy(Planner_s* planner);
+// Escolhe e aplica as ações do jogador para o próximo passo (só em PLAYING), como autoPlayerAct.
+void plannerAct(Planner_s* planner, GameWorld_s* world);
+
+#endif // PLANNER_H
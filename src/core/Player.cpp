@@ -0,0 +1,84 @@
+#include "Player.h"
+#include <stdio.h>   // Para a função printf (se for necessário para depuração).
+
+/**
+ * Inicializa ou reseta as variáveis do jogador para o estado padrão de início de jogo.
+ */
+void initPlayer(GameWorld_s* world) {
+    // Define a posição inicial do jogador no cenário.
+    world->player.x = 100;
+    world->player.y = GROUND_LEVEL;
+    world->player.prevX = world->player.x;
+    world->player.prevY = world->player.y;
+    // Define as dimensões da caixa de colisão (hitbox) do jogador.
+    world->player.width = PLAYER_WIDTH;
+    world->player.height = PLAYER_HEIGHT;
+    // Flags que controlam o estado de pulo e agachamento. Começam em 0 (falso).
+    world->player.jumping = 0;
+    world->player.ducking = 0;
+    // A velocidade vertical do jogador, começa em 0.
+    world->player.jumpVelocity = 0;
+    // O tipo de lixo que o jogador começa segurando.
+    world->player.selectedTrash = PLASTIC; 
+    // Variáveis para controlar a animação de corrida, são resetadas aqui.
+    world->playerAnimationTimer = 0.0f;
+    world->currentPlayerRunFrame = 0;
+}
+
+/**
+ * Atualiza a lógica de movimento (pulo) e de animação do jogador a cada quadro.
+ * Esta função é chamada repetidamente pela função updateGame.
+ */
+void updatePlayerAnimation(GameWorld_s* world) {
+    // --- Lógica de Pulo ---
+    // Este bloco só é executado se o jogador estiver no estado "pulando".
+    if (world->player.jumping) {
+        // Atualiza a posição vertical do jogador com base na sua velocidade de pulo.
+        world->player.y += world->player.jumpVelocity;
+        // Aplica a força da gravidade, diminuindo a velocidade de subida (ou aumentando a de descida).
+        world->player.jumpVelocity -= GRAVITY;
+        
+        // Verifica se o jogador tocou ou atravessou o chão.
+        if (world->player.y <= GROUND_LEVEL) {
+            // Se tocou o chão, "trava" o jogador na posição correta para evitar que afunde.
+            world->player.y = GROUND_LEVEL;
+            // Desativa o estado de pulo e zera a velocidade para encerrar o movimento.
+            world->player.jumping = 0;
+            world->player.jumpVelocity = 0;
+        }
+    } 
+    // --- Lógica de Animação de Corrida ---
+    // Este bloco só é executado se o jogador NÃO estiver pulando E NÃO estiver agachado.
+    else if (!world->player.ducking) { 
+        // Acumula a duração de um passo da simulação (fixa, aproximadamente 1/60 de segundo).
+        world->playerAnimationTimer += SIM_TICK_SECONDS;
+        // Verifica se já se passou tempo suficiente para trocar o frame da animação.
+        if (world->playerAnimationTimer >= PLAYER_ANIMATION_FRAME_DURATION) {
+            // Se sim, reseta o timer...
+            world->playerAnimationTimer = 0.0f;
+            // ...e alterna o frame da animação de corrida (de 0 para 1, e de 1 para 0).
+            world->currentPlayerRunFrame = (world->currentPlayerRunFrame + 1) % 2; 
+        }
+    }
+}
+
+/**
+ * Começa um pulo, se o jogador estiver no chão e em pé. Devolve 1 se o pulo começou.
+ * Usada pelo teclado (Input.cpp) e por quem controla o jogador sem teclado (ver VecEnv.h).
+ */
+int playerJump(GameWorld_s* world) {
+    if (world->player.jumping || world->player.ducking) return 0;
+    world->player.jumping = 1; // Ativa a flag de pulo.
+    world->player.jumpVelocity = JUMP_INITIAL_VELOCITY; // Dá ao jogador o impulso inicial do pulo.
+    return 1;
+}
+
+/**
+ * Agacha (down = 1) ou levanta (down = 0) o jogador, como a tecla S pressionada ou solta.
+ * Não dá para agachar no meio de um pulo; levantar sempre funciona. Devolve 1 se a ação foi aceita.
+ */
+int playerSetDucking(GameWorld_s* world, int down) {
+    if (down && world->player.jumping) return 0;
+    world->player.ducking = down ? 1 : 0;
+    return 1;
+}
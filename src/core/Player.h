@@ -0,0 +1,15 @@
+#ifndef PLAYER_H
+#define PLAYER_H
+
+#include "World.h" // Inclui World.h para ter acesso à struct Player_s e constantes.
+
+// --- Protótipos de Funções ---
+// Estes são os "anúncios" das funções que estão definidas em Player.cpp.
+// Qualquer outro arquivo que inclua Player.h saberá que essas funções existem.
+
+void initPlayer(GameWorld_s* world);            // Para inicializar o estado do jogador.
+void updatePlayerAnimation(GameWorld_s* world); // Para atualizar a física e animação do jogador a cada quadro.
+int playerJump(GameWorld_s* world);             // Começa um pulo, se possível (devolve 1 se começou).
+int playerSetDucking(GameWorld_s* world, int down); // Agacha (1) ou levanta (0) o jogador (devolve 1 se a ação foi aceita).
+
+#endif // PLAYER_H
\ No newline at end of file
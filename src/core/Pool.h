@@ -0,0 +1,167 @@
+#ifndef POOL_H
+#define POOL_H
+
+#include <stdlib.h>
+#include <string.h>
+
+// --- Pool de Objetos Denso e Expansível ---
+// Guarda os objetos do cenário em "estrutura de arrays" (SoA): cada propriedade é um array
+// contínuo, e os objetos vivos ocupam sempre as posições [0, count) sem buracos.
+//  - Criar (poolSpawn) acrescenta no fim: O(1).
+//  - Remover (poolDespawn) move o último objeto para o lugar do removido ("swap-remove"): O(1).
+//  - Quando a capacidade acaba, os arrays dobram de tamanho em vez de descartar o objeto novo.
+// Assim os laços de atualização, colisão e desenho percorrem apenas objetos vivos,
+// sem precisar testar uma flag 'active' em cada posição.
+//
+// Como o swap-remove muda a posição dos objetos, quem precisa guardar uma referência estável
+// para um objeto usa um PoolHandle_s. Cada handle aponta para um "slot" que sabe em que
+// posição densa o objeto está agora; slots livres formam uma lista encadeada (free list).
+// A geração do slot aumenta a cada remoção, invalidando handles antigos.
+//
+// Um pool zerado (por exemplo, uma variável global) já é um pool vazio válido.
+
+// Referência estável para um objeto de um pool.
+typedef struct {
+    int slot;
+    int generation;
+} PoolHandle_s;
+
+// 'TypeEnum' é o enum do tipo do objeto (ObstacleType, TrashType...).
+template <typename TypeEnum>
+struct EntityPool_s {
+    // --- Colunas densas: o objeto i é formado por x[i], y[i], type[i]... com 0 <= i < count. ---
+    float *x, *y;
+    float *prevX, *prevY;         // Posição no passo anterior, usada para interpolar o desenho.
+    float *width, *height;
+    float *velocityX, *velocityY; // Usadas apenas pelo lixo arremessado.
+    float *originX, *originY;     // Lixo arremessado: ponto de lançamento da trajetória.
+    long long *spawnTick;         // Lixo arremessado: passo em que foi lançado.
+    long long *eventTick;         // Lixo arremessado: passo previsto do acerto ou da saída da tela.
+    TypeEnum* type;
+    int* slotOf;                  // Slot (handle) do objeto que está na posição densa i.
+
+    // --- Slots: um por posição de capacidade. ---
+    int* denseOf;                 // Posição densa do objeto do slot, ou -1 se o slot está livre.
+    int* generation;              // Geração atual do slot.
+    int* nextFree;                // Próximo slot livre na free list.
+    int freeHead;                 // Primeiro slot livre (-1 se nenhum).
+
+    int count;                    // Número de objetos vivos.
+    int capacity;                 // Tamanho atual dos arrays.
+};
+
+// Realoca um array para 'newCapacity' elementos (função auxiliar dos pools).
+template <typename T>
+static inline void poolGrowArray(T** array, int newCapacity) {
+    *array = (T*)realloc(*array, sizeof(T) * (size_t)newCapacity);
+}
+
+/**
+ * Garante espaço para pelo menos 'capacity' objetos, sem mudar os objetos existentes.
+ * Os slots novos entram na free list.
+ */
+template <typename TypeEnum>
+void poolReserve(EntityPool_s<TypeEnum>* pool, int capacity) {
+    if (capacity <= pool->capacity) return;
+    int oldCapacity = pool->capacity;
+    if (oldCapacity == 0) pool->freeHead = -1;
+
+    poolGrowArray(&pool->x, capacity);         poolGrowArray(&pool->y, capacity);
+    poolGrowArray(&pool->prevX, capacity);     poolGrowArray(&pool->prevY, capacity);
+    poolGrowArray(&pool->width, capacity);     poolGrowArray(&pool->height, capacity);
+    poolGrowArray(&pool->velocityX, capacity); poolGrowArray(&pool->velocityY, capacity);
+    poolGrowArray(&pool->originX, capacity);   poolGrowArray(&pool->originY, capacity);
+    poolGrowArray(&pool->spawnTick, capacity); poolGrowArray(&pool->eventTick, capacity);
+    poolGrowArray(&pool->type, capacity);      poolGrowArray(&pool->slotOf, capacity);
+    poolGrowArray(&pool->denseOf, capacity);   poolGrowArray(&pool->generation, capacity);
+    poolGrowArray(&pool->nextFree, capacity);
+
+    // Encadeia os slots novos na free list, mantendo a ordem crescente.
+    for (int s = capacity - 1; s >= oldCapacity; s--) {
+        pool->denseOf[s] = -1;
+        pool->generation[s] = 0;
+        pool->nextFree[s] = pool->freeHead;
+        pool->freeHead = s;
+    }
+    pool->capacity = capacity;
+}
+
+/**
+ * Cria um objeto novo no fim da parte densa e devolve sua posição (índice).
+ * Se o pool estiver cheio, a capacidade dobra. As colunas do objeto novo não são inicializadas.
+ */
+template <typename TypeEnum>
+int poolSpawn(EntityPool_s<TypeEnum>* pool) {
+    if (pool->count == pool->capacity) {
+        poolReserve(pool, pool->capacity > 0 ? pool->capacity * 2 : 8);
+    }
+    // Retira um slot da free list e liga-o à nova posição densa.
+    int slot = pool->freeHead;
+    pool->freeHead = pool->nextFree[slot];
+    int index = pool->count++;
+    pool->denseOf[slot] = index;
+    pool->slotOf[index] = slot;
+    return index;
+}
+
+/**
+ * Remove o objeto da posição 'index'. O último objeto é movido para o lugar dele,
+ * então quem percorre o pool removendo objetos NÃO deve avançar o índice após uma remoção.
+ */
+template <typename TypeEnum>
+void poolDespawn(EntityPool_s<TypeEnum>* pool, int index) {
+    int last = pool->count - 1;
+    int slot = pool->slotOf[index];
+    if (index != last) {
+        pool->x[index] = pool->x[last];                 pool->y[index] = pool->y[last];
+        pool->prevX[index] = pool->prevX[last];         pool->prevY[index] = pool->prevY[last];
+        pool->width[index] = pool->width[last];         pool->height[index] = pool->height[last];
+        pool->velocityX[index] = pool->velocityX[last]; pool->velocityY[index] = pool->velocityY[last];
+        pool->originX[index] = pool->originX[last];     pool->originY[index] = pool->originY[last];
+        pool->spawnTick[index] = pool->spawnTick[last]; pool->eventTick[index] = pool->eventTick[last];
+        pool->type[index] = pool->type[last];
+        pool->slotOf[index] = pool->slotOf[last];
+        pool->denseOf[pool->slotOf[index]] = index;
+    }
+    // Devolve o slot à free list; a nova geração invalida os handles que apontavam para ele.
+    pool->denseOf[slot] = -1;
+    pool->generation[slot]++;
+    pool->nextFree[slot] = pool->freeHead;
+    pool->freeHead = slot;
+    pool->count--;
+}
+
+// Remove todos os objetos, mantendo a memória já alocada.
+template <typename TypeEnum>
+void poolClear(EntityPool_s<TypeEnum>* pool) {
+    while (pool->count > 0) poolDespawn(pool, pool->count - 1);
+}
+
+// Handle estável para o objeto que está agora na posição 'index'.
+template <typename TypeEnum>
+PoolHandle_s poolHandleAt(const EntityPool_s<TypeEnum>* pool, int index) {
+    PoolHandle_s handle;
+    handle.slot = pool->slotOf[index];
+    handle.generation = pool->generation[handle.slot];
+    return handle;
+}
+
+// Posição densa atual do objeto do handle, ou -1 se ele já foi removido.
+template <typename TypeEnum>
+int poolIndexOf(const EntityPool_s<TypeEnum>* pool, PoolHandle_s handle) {
+    if (handle.slot < 0 || handle.slot >= pool->capacity) return -1;
+    if (pool->generation[handle.slot] != handle.generation) return -1;
+    return pool->denseOf[handle.slot];
+}
+
+// Libera toda a memória do pool, deixando-o vazio (e reutilizável).
+template <typename TypeEnum>
+void poolFree(EntityPool_s<TypeEnum>* pool) {
+    free(pool->x); free(pool->y); free(pool->prevX); free(pool->prevY);
+    free(pool->width); free(pool->height); free(pool->velocityX); free(pool->velocityY);
+    free(pool->originX); free(pool->originY); free(pool->spawnTick); free(pool->eventTick);
+    free(pool->type); free(pool->slotOf); free(pool->denseOf); free(pool->generation); free(pool->nextFree);
+    memset(pool, 0, sizeof(*pool));
+}
+
+#endif // POOL_H
@@ -0,0 +1,51 @@
+#include "Random.h"
+
+// Constantes do Philox4x32 (Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3", 2011).
+#define PHILOX_M0 0xD2511F53u // Multiplicadores das duas metades do contador.
+#define PHILOX_M1 0xCD9E8D57u
+#define PHILOX_W0 0x9E3779B9u // Incrementos da chave a cada rodada (constantes "de Weyl").
+#define PHILOX_W1 0xBB67AE85u
+#define PHILOX_ROUNDS 10
+
+/**
+ * Embaralha o contador com a chave em 10 rodadas. Cada rodada multiplica duas palavras
+ * (32 x 32 -> 64 bits) e mistura as metades alta e baixa com as outras palavras e com a chave.
+ */
+RandomBlock_s philox4x32(const unsigned int counter[4], unsigned long long key) {
+    unsigned int c0 = counter[0], c1 = counter[1], c2 = counter[2], c3 = counter[3];
+    unsigned int k0 = (unsigned int)key, k1 = (unsigned int)(key >> 32);
+    for (int round = 0; round < PHILOX_ROUNDS; round++) {
+        unsigned long long p0 = (unsigned long long)PHILOX_M0 * c0;
+        unsigned long long p1 = (unsigned long long)PHILOX_M1 * c2;
+        unsigned int hi0 = (unsigned int)(p0 >> 32), lo0 = (unsigned int)p0;
+        unsigned int hi1 = (unsigned int)(p1 >> 32), lo1 = (unsigned int)p1;
+        c0 = hi1 ^ c1 ^ k0;
+        c1 = lo1;
+        c2 = hi0 ^ c3 ^ k1;
+        c3 = lo0;
+        k0 += PHILOX_W0;
+        k1 += PHILOX_W1;
+    }
+    RandomBlock_s block = {{c0, c1, c2, c3}};
+    return block;
+}
+
+/**
+ * O contador é (índice de 64 bits, fluxo, partida): cada combinação dá um bloco diferente.
+ */
+RandomBlock_s randomBlock(unsigned long long seed, long long match, RandomStream stream, long long index) {
+    unsigned int counter[4];
+    counter[0] = (unsigned int)index;
+    counter[1] = (unsigned int)((unsigned long long)index >> 32);
+    counter[2] = (unsigned int)stream;
+    counter[3] = (unsigned int)match;
+    return philox4x32(counter, seed);
+}
+
+/**
+ * Multiplica a palavra pelo intervalo e fica com os 32 bits altos: o resultado cai em [0, range).
+ * O viés é de no máximo range / 2^32, desprezível para os intervalos do jogo.
+ */
+int randomBelow(unsigned int word, int range) {
+    return (int)(((unsigned long long)word * (unsigned int)range) >> 32);
+}
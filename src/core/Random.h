@@ -0,0 +1,35 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+
+// --- Gerador Aleatório Baseado em Contador (Philox4x32-10) ---
+// Em vez de um estado escondido que avança a cada sorteio (como o rand() da libc), cada número
+// é uma função pura de (semente, fluxo, índice): embaralha-se o contador com a semente como chave.
+// Consequências:
+//  - a mesma semente sempre gera a mesma fase, em qualquer máquina;
+//  - o N-ésimo sorteio de um fluxo sai em O(1), sem repetir os anteriores;
+//  - simulações em paralelo não disputam nenhum estado compartilhado.
+// Cada chamada produz 4 palavras de 32 bits independentes.
+
+// Fluxos de sorteio: cada tipo de decisão do jogo tem o seu, para que uma não desloque a outra.
+enum RandomStream {
+    RNG_STREAM_OBSTACLE,   // N-ésimo obstáculo posicionado: palavra 0 = tipo, palavra 1 = espaçamento.
+    RNG_STREAM_TRASHBIN,   // N-ésima lixeira posicionada: palavra 0 = espaçamento.
+    RNG_STREAM_RELOCATION, // N-ésimo obstáculo jogado para longe após atingir o jogador: palavra 0 = distância extra.
+    RNG_STREAM_COUNT
+};
+
+typedef struct {
+    unsigned int word[4];
+} RandomBlock_s;
+
+// O bloco de 4 palavras para um contador de 128 bits (counter[0] é a parte menos significativa)
+// e uma chave de 64 bits.
+RandomBlock_s philox4x32(const unsigned int counter[4], unsigned long long key);
+
+// Bloco do sorteio 'index' do fluxo 'stream' na partida 'match', com a semente 'seed'.
+RandomBlock_s randomBlock(unsigned long long seed, long long match, RandomStream stream, long long index);
+
+// Converte uma palavra de 32 bits em um inteiro em [0, range), sem usar o resto da divisão.
+int randomBelow(unsigned int word, int range);
+
+#endif // RANDOM_H
@@ -0,0 +1,52 @@
+#include "ScrollQueue.h"
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * Dobra o tamanho do buffer circular. Os handles são copiados já "desenrolados",
+ * ou seja, o início da fila passa a ficar na posição 0.
+ */
+static void scrollQueueGrow(ScrollQueue_s* queue) {
+    int newCapacity = queue->capacity > 0 ? queue->capacity * 2 : 8;
+    PoolHandle_s* entries = (PoolHandle_s*)malloc(sizeof(PoolHandle_s) * (size_t)newCapacity);
+    for (int i = 0; i < queue->count; i++) {
+        entries[i] = queue->entries[(queue->head + i) & (queue->capacity - 1)];
+    }
+    free(queue->entries);
+    queue->entries = entries;
+    queue->head = 0;
+    queue->capacity = newCapacity;
+}
+
+void scrollQueueClear(ScrollQueue_s* queue) {
+    queue->head = 0;
+    queue->count = 0;
+    queue->tailRight = 0.0f;
+}
+
+void scrollQueuePushBack(ScrollQueue_s* queue, PoolHandle_s handle, float rightEdge) {
+    if (queue->count == queue->capacity) scrollQueueGrow(queue);
+    // Como a capacidade é potência de 2, "& (capacity - 1)" equivale a "% capacity".
+    queue->entries[(queue->head + queue->count) & (queue->capacity - 1)] = handle;
+    queue->count++;
+    queue->tailRight = rightEdge;
+}
+
+PoolHandle_s scrollQueueFront(const ScrollQueue_s* queue) {
+    return queue->entries[queue->head];
+}
+
+void scrollQueuePopFront(ScrollQueue_s* queue) {
+    queue->head = (queue->head + 1) & (queue->capacity - 1);
+    queue->count--;
+}
+
+void scrollQueueAdvance(ScrollQueue_s* queue, float dx) {
+    // Os objetos da fila andaram 'dx' para a esquerda; a referência do fim anda junto.
+    queue->tailRight -= dx;
+}
+
+void scrollQueueFree(ScrollQueue_s* queue) {
+    free(queue->entries);
+    memset(queue, 0, sizeof(*queue));
+}
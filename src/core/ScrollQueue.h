@@ -0,0 +1,33 @@
+#ifndef SCROLLQUEUE_H
+#define SCROLLQUEUE_H
+
+#include "Pool.h"
+
+// --- Fila de Rolagem (ring buffer) ---
+// Todos os obstáculos (e todas as lixeiras) andam para a esquerda com a mesma velocidade,
+// então a ordem deles no eixo X nunca muda. A fila guarda os handles nessa ordem:
+//  - o início (front) é sempre o objeto mais à esquerda, o próximo a sair da tela;
+//  - o fim (back) é o mais à direita, a referência para posicionar o próximo objeto.
+// Reciclar um objeto é retirá-lo do início e colocá-lo no fim: O(1), sem procurar
+// o objeto mais à direita a cada vez.
+//
+// Objetos removidos do pool (ex.: um monstro destruído) deixam o handle na fila; ele fica
+// inválido (ver poolIndexOf) e é descartado quando chega ao início.
+// Uma fila zerada (por exemplo, uma variável global) já é uma fila vazia válida.
+
+typedef struct {
+    PoolHandle_s* entries; // Buffer circular com os handles, em ordem crescente de X.
+    int head;              // Posição do primeiro handle no buffer.
+    int count;             // Quantidade de handles na fila.
+    int capacity;          // Tamanho do buffer (sempre uma potência de 2).
+    float tailRight;       // Borda direita (em X) do último objeto colocado no fim da fila.
+} ScrollQueue_s;
+
+void scrollQueueClear(ScrollQueue_s* queue);                                   // Esvazia a fila (mantém a memória).
+void scrollQueuePushBack(ScrollQueue_s* queue, PoolHandle_s handle, float rightEdge); // Coloca um objeto no fim.
+PoolHandle_s scrollQueueFront(const ScrollQueue_s* queue);                     // Handle do objeto mais à esquerda.
+void scrollQueuePopFront(ScrollQueue_s* queue);                                // Retira o objeto do início.
+void scrollQueueAdvance(ScrollQueue_s* queue, float dx);                       // Acompanha a rolagem dos objetos (x -= dx).
+void scrollQueueFree(ScrollQueue_s* queue);                                    // Libera a memória da fila.
+
+#endif // SCROLLQUEUE_H
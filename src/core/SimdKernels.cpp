@@ -0,0 +1,218 @@
+#include "SimdKernels.h"
+
+// As instruções SSE/AVX só existem em processadores x86. Em outras arquiteturas
+// (ou compiladores sem suporte) fica apenas a versão escalar.
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #define ECO_SIMD_X86 1
+    #include <immintrin.h>
+#else
+    #define ECO_SIMD_X86 0
+#endif
+
+// --- Versões Escalares (referência) ---
+// Fazem exatamente as mesmas operações, na mesma ordem, que as versões vetorizadas:
+// os resultados são idênticos bit a bit, qualquer que seja o nível escolhido.
+// 'begin' permite que as versões SIMD terminem aqui os objetos que sobraram.
+
+static void scrollEntitiesScalar(float* x, int begin, int count, float dx) {
+    for (int i = begin; i < count; i++) {
+        x[i] -= dx;
+    }
+}
+
+// Cada objeto fica em um registrador durante todos os passos, mas as subtrações continuam
+// sendo feitas uma a uma, na ordem dos passos (o mesmo que chamar scrollEntities 'steps' vezes).
+static void scrollEntitiesSeriesScalar(float* x, int begin, int count, const float* dx, int steps) {
+    for (int i = begin; i < count; i++) {
+        float v = x[i];
+        for (int s = 0; s < steps; s++) v -= dx[s];
+        x[i] = v;
+    }
+}
+
+// Mesmo teste usado em checkAllCollisions: right > alvoLeft && left < alvoRight && top > alvoBottom && bottom < alvoTop.
+static unsigned int overlapBoxesScalar(float left, float right, float bottom, float top,
+                                       const float* targetLeft, const float* targetRight,
+                                       const float* targetBottom, const float* targetTop, int begin, int count) {
+    unsigned int mask = 0;
+    for (int k = begin; k < count; k++) {
+        if (right > targetLeft[k] && left < targetRight[k] && top > targetBottom[k] && bottom < targetTop[k]) {
+            mask |= 1u << k;
+        }
+    }
+    return mask;
+}
+
+#if ECO_SIMD_X86
+// --- Versões SSE2 (4 objetos por vez) ---
+
+__attribute__((target("sse2")))
+static void scrollEntitiesSse2(float* x, int count, float dx) {
+    const __m128 delta = _mm_set1_ps(dx);
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(x + i, _mm_sub_ps(_mm_loadu_ps(x + i), delta));
+    }
+    // Os objetos que sobraram (menos de 4) usam a versão escalar.
+    scrollEntitiesScalar(x, i, count, dx);
+}
+
+__attribute__((target("sse2")))
+static void scrollEntitiesSeriesSse2(float* x, int count, const float* dx, int steps) {
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 v = _mm_loadu_ps(x + i);
+        for (int s = 0; s < steps; s++) v = _mm_sub_ps(v, _mm_set1_ps(dx[s]));
+        _mm_storeu_ps(x + i, v);
+    }
+    scrollEntitiesSeriesScalar(x, i, count, dx, steps);
+}
+
+// As 4 comparações geram máscaras de lanes (todos os bits 1 = verdadeiro); o 'and' entre elas
+// e o movemask transformam o resultado de 4 alvos em 4 bits da máscara final.
+__attribute__((target("sse2")))
+static unsigned int overlapBoxesSse2(float left, float right, float bottom, float top,
+                                     const float* targetLeft, const float* targetRight,
+                                     const float* targetBottom, const float* targetTop, int count) {
+    const __m128 l = _mm_set1_ps(left), r = _mm_set1_ps(right);
+    const __m128 b = _mm_set1_ps(bottom), t = _mm_set1_ps(top);
+    unsigned int mask = 0;
+    int k = 0;
+    for (; k + 4 <= count; k += 4) {
+        __m128 hit = _mm_and_ps(_mm_cmpgt_ps(r, _mm_loadu_ps(targetLeft + k)),
+                                _mm_cmplt_ps(l, _mm_loadu_ps(targetRight + k)));
+        hit = _mm_and_ps(hit, _mm_and_ps(_mm_cmpgt_ps(t, _mm_loadu_ps(targetBottom + k)),
+                                         _mm_cmplt_ps(b, _mm_loadu_ps(targetTop + k))));
+        mask |= (unsigned int)_mm_movemask_ps(hit) << k;
+    }
+    return mask | overlapBoxesScalar(left, right, bottom, top, targetLeft, targetRight, targetBottom, targetTop, k, count);
+}
+
+// --- Versões AVX (8 objetos por vez) ---
+
+__attribute__((target("avx")))
+static void scrollEntitiesAvx(float* x, int count, float dx) {
+    const __m256 delta = _mm256_set1_ps(dx);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_ps(x + i, _mm256_sub_ps(_mm256_loadu_ps(x + i), delta));
+    }
+    scrollEntitiesScalar(x, i, count, dx);
+}
+
+// Máscara com as 'n' primeiras lanes ligadas (n pode ser <= 0 ou >= 8).
+// O AVX (sem o AVX2) não compara inteiros de 256 bits, então a comparação é feita em float.
+__attribute__((target("avx")))
+static __m256i firstLanesMask(int n) {
+    const __m256 lane = _mm256_setr_ps(0, 1, 2, 3, 4, 5, 6, 7);
+    return _mm256_castps_si256(_mm256_cmp_ps(lane, _mm256_set1_ps((float)n), _CMP_LT_OQ));
+}
+
+// Aqui a sobra não vai para o escalar: seriam várias cadeias de subtrações, uma depois da outra.
+// Com load/store mascarados, até 16 objetos ficam em duas cadeias independentes que andam juntas.
+__attribute__((target("avx")))
+static void scrollEntitiesSeriesAvx(float* x, int count, const float* dx, int steps) {
+    for (int i = 0; i < count; i += 16) {
+        const __m256i mask0 = firstLanesMask(count - i), mask1 = firstLanesMask(count - i - 8);
+        __m256 v0 = _mm256_maskload_ps(x + i, mask0);
+        __m256 v1 = _mm256_maskload_ps(x + i + 8, mask1);
+        for (int s = 0; s < steps; s++) {
+            const __m256 delta = _mm256_set1_ps(dx[s]);
+            v0 = _mm256_sub_ps(v0, delta);
+            v1 = _mm256_sub_ps(v1, delta);
+        }
+        _mm256_maskstore_ps(x + i, mask0, v0);
+        _mm256_maskstore_ps(x + i + 8, mask1, v1);
+    }
+}
+
+__attribute__((target("avx")))
+static unsigned int overlapBoxesAvx(float left, float right, float bottom, float top,
+                                    const float* targetLeft, const float* targetRight,
+                                    const float* targetBottom, const float* targetTop, int count) {
+    const __m256 l = _mm256_set1_ps(left), r = _mm256_set1_ps(right);
+    const __m256 b = _mm256_set1_ps(bottom), t = _mm256_set1_ps(top);
+    unsigned int mask = 0;
+    int k = 0;
+    for (; k + 8 <= count; k += 8) {
+        // _CMP_GT_OQ / _CMP_LT_OQ: comparações "ordenadas", falsas com NaN, como no C.
+        __m256 hit = _mm256_and_ps(_mm256_cmp_ps(r, _mm256_loadu_ps(targetLeft + k), _CMP_GT_OQ),
+                                   _mm256_cmp_ps(l, _mm256_loadu_ps(targetRight + k), _CMP_LT_OQ));
+        hit = _mm256_and_ps(hit, _mm256_and_ps(_mm256_cmp_ps(t, _mm256_loadu_ps(targetBottom + k), _CMP_GT_OQ),
+                                               _mm256_cmp_ps(b, _mm256_loadu_ps(targetTop + k), _CMP_LT_OQ)));
+        mask |= (unsigned int)_mm256_movemask_ps(hit) << k;
+    }
+    // Sobra de 4 a 7 alvos: ainda vale um passo SSE antes do escalar.
+    if (k + 4 <= count) {
+        mask |= overlapBoxesSse2(left, right, bottom, top, targetLeft + k, targetRight + k,
+                                 targetBottom + k, targetTop + k, count - k) << k;
+        return mask;
+    }
+    return mask | overlapBoxesScalar(left, right, bottom, top, targetLeft, targetRight, targetBottom, targetTop, k, count);
+}
+#endif // ECO_SIMD_X86
+
+// --- Seleção do Nível em Tempo de Execução ---
+// -1 indica "ainda não detectado"; a detecção acontece na primeira chamada.
+static int currentLevel = -1;
+
+SimdLevel detectSimdLevel() {
+#if ECO_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx")) return SIMD_AVX;
+    if (__builtin_cpu_supports("sse2")) return SIMD_SSE2;
+#endif
+    return SIMD_SCALAR;
+}
+
+SimdLevel getSimdLevel() {
+    if (currentLevel < 0) currentLevel = detectSimdLevel();
+    return (SimdLevel)currentLevel;
+}
+
+void setSimdLevel(SimdLevel level) {
+    SimdLevel supported = detectSimdLevel();
+    // Nunca permite um nível acima do que a CPU realmente executa.
+    currentLevel = (level > supported) ? supported : level;
+}
+
+const char* simdLevelName(SimdLevel level) {
+    switch (level) {
+        case SIMD_SCALAR: return "scalar";
+        case SIMD_SSE2:   return "sse2";
+        case SIMD_AVX:    return "avx";
+        default:          return "?";
+    }
+}
+
+void scrollEntities(float* x, int count, float dx) {
+    switch (getSimdLevel()) {
+#if ECO_SIMD_X86
+        case SIMD_AVX:  scrollEntitiesAvx(x, count, dx); return;
+        case SIMD_SSE2: scrollEntitiesSse2(x, count, dx); return;
+#endif
+        default:        scrollEntitiesScalar(x, 0, count, dx); return;
+    }
+}
+
+void scrollEntitiesSeries(float* x, int count, const float* dx, int steps) {
+    switch (getSimdLevel()) {
+#if ECO_SIMD_X86
+        case SIMD_AVX:  scrollEntitiesSeriesAvx(x, count, dx, steps); return;
+        case SIMD_SSE2: scrollEntitiesSeriesSse2(x, count, dx, steps); return;
+#endif
+        default:        scrollEntitiesSeriesScalar(x, 0, count, dx, steps); return;
+    }
+}
+
+unsigned int overlapBoxes(float left, float right, float bottom, float top,
+                          const float* targetLeft, const float* targetRight,
+                          const float* targetBottom, const float* targetTop, int count) {
+    switch (getSimdLevel()) {
+#if ECO_SIMD_X86
+        case SIMD_AVX:  return overlapBoxesAvx(left, right, bottom, top, targetLeft, targetRight, targetBottom, targetTop, count);
+        case SIMD_SSE2: return overlapBoxesSse2(left, right, bottom, top, targetLeft, targetRight, targetBottom, targetTop, count);
+#endif
+        default:        return overlapBoxesScalar(left, right, bottom, top, targetLeft, targetRight, targetBottom, targetTop, 0, count);
+    }
+}
@@ -0,0 +1,41 @@
+#ifndef SIMDKERNELS_H
+#define SIMDKERNELS_H
+
+// --- Kernels Vetorizados (SIMD) ---
+// Rotinas que atualizam vários objetos de uma vez com instruções SSE/AVX.
+// Trabalham diretamente sobre as colunas dos pools (estrutura de arrays, ver Pool.h):
+// cada coluna (x, y, velocidade...) é um array contínuo, então 4 (SSE) ou 8 (AVX)
+// objetos cabem em um único registrador.
+// A variante usada é escolhida em tempo de execução, conforme o que a CPU suporta.
+
+// Níveis de instrução disponíveis, do mais simples ao mais largo.
+enum SimdLevel {
+    SIMD_SCALAR, // Laço comum em C, funciona em qualquer CPU.
+    SIMD_SSE2,   // 4 floats por instrução.
+    SIMD_AVX,    // 8 floats por instrução.
+    SIMD_LEVEL_COUNT
+};
+
+SimdLevel detectSimdLevel();                 // Maior nível suportado pela CPU atual.
+SimdLevel getSimdLevel();                    // Nível em uso pelos kernels.
+void setSimdLevel(SimdLevel level);          // Força um nível (limitado ao suportado). Útil em benchmarks.
+const char* simdLevelName(SimdLevel level);  // Nome legível do nível ("scalar", "sse2", "avx").
+
+// Os pools são densos (ver Pool.h): todos os 'count' objetos estão vivos, sem máscara de ativos.
+
+// Desloca horizontalmente os objetos: x[i] -= dx (movimento de rolagem da tela).
+void scrollEntities(float* x, int count, float dx);
+// Vários passos de rolagem de uma vez: x[i] -= dx[0]; x[i] -= dx[1]; ... (até dx[steps - 1]).
+// O resultado é o mesmo de chamar scrollEntities uma vez por passo, mas cada objeto é lido e
+// escrito uma vez só. Usado pelo salto de passos sem eventos (ver skipTicks).
+void scrollEntitiesSeries(float* x, int count, const float* dx, int steps);
+
+// Teste de colisão em lote: compara uma caixa (esquerda, direita, base, topo) com até
+// OVERLAP_BATCH_MAX caixas-alvo, guardadas em colunas. Devolve uma máscara de bits:
+// o bit k fica ligado se a caixa se sobrepõe (estritamente) ao alvo k.
+#define OVERLAP_BATCH_MAX 32
+unsigned int overlapBoxes(float left, float right, float bottom, float top,
+                          const float* targetLeft, const float* targetRight,
+                          const float* targetBottom, const float* targetTop, int count);
+
+#endif // SIMDKERNELS_H
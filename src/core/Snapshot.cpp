@@ -0,0 +1,122 @@
+#include "Snapshot.h"
+#include "ScrollQueue.h"
+#include <string.h>
+
+// Copia as colunas dos objetos vivos entre um pool e um retrato (só as 'count' primeiras posições).
+#define COPY_POOL_COLUMNS(dst, src, count) do {                                      \
+    memcpy((dst)->x, (src)->x, sizeof(*(dst)->x) * (count));                         \
+    memcpy((dst)->y, (src)->y, sizeof(*(dst)->y) * (count));                         \
+    memcpy((dst)->prevX, (src)->prevX, sizeof(*(dst)->prevX) * (count));             \
+    memcpy((dst)->prevY, (src)->prevY, sizeof(*(dst)->prevY) * (count));             \
+    memcpy((dst)->width, (src)->width, sizeof(*(dst)->width) * (count));             \
+    memcpy((dst)->height, (src)->height, sizeof(*(dst)->height) * (count));          \
+    memcpy((dst)->velocityX, (src)->velocityX, sizeof(*(dst)->velocityX) * (count)); \
+    memcpy((dst)->velocityY, (src)->velocityY, sizeof(*(dst)->velocityY) * (count)); \
+    memcpy((dst)->originX, (src)->originX, sizeof(*(dst)->originX) * (count));       \
+    memcpy((dst)->originY, (src)->originY, sizeof(*(dst)->originY) * (count));       \
+    memcpy((dst)->spawnTick, (src)->spawnTick, sizeof(*(dst)->spawnTick) * (count)); \
+    memcpy((dst)->eventTick, (src)->eventTick, sizeof(*(dst)->eventTick) * (count)); \
+    memcpy((dst)->type, (src)->type, sizeof(*(dst)->type) * (count));                \
+} while (0)
+
+template <typename TypeEnum, int Capacity>
+static void savePool(const EntityPool_s<TypeEnum>* pool, PoolSnapshot_s<TypeEnum, Capacity>* saved) {
+    saved->count = pool->count;
+    COPY_POOL_COLUMNS(saved, pool, pool->count);
+}
+
+/**
+ * Deixa o pool com os objetos do retrato. Os slots são refeitos do zero: handles antigos
+ * deixam de valer (as filas são reconstruídas logo depois com handles novos).
+ */
+template <typename TypeEnum, int Capacity>
+static void restorePool(EntityPool_s<TypeEnum>* pool, const PoolSnapshot_s<TypeEnum, Capacity>* saved) {
+    poolClear(pool);
+    poolReserve(pool, saved->count);
+    for (int i = 0; i < saved->count; i++) poolSpawn(pool);
+    COPY_POOL_COLUMNS(pool, saved, saved->count);
+}
+
+template <typename TypeEnum, int Capacity>
+static void saveQueue(const ScrollQueue_s* queue, const EntityPool_s<TypeEnum>* pool, QueueSnapshot_s<Capacity>* saved) {
+    saved->count = 0;
+    saved->tailRight = queue->tailRight;
+    for (int q = 0; q < queue->count; q++) {
+        int i = poolIndexOf(pool, queue->entries[(queue->head + q) & (queue->capacity - 1)]);
+        if (i >= 0) saved->order[saved->count++] = (unsigned char)i;
+    }
+}
+
+template <typename TypeEnum, int Capacity>
+static void restoreQueue(ScrollQueue_s* queue, const EntityPool_s<TypeEnum>* pool, const QueueSnapshot_s<Capacity>* saved) {
+    scrollQueueClear(queue);
+    for (int q = 0; q < saved->count; q++) {
+        int i = saved->order[q];
+        scrollQueuePushBack(queue, poolHandleAt(pool, i), pool->x[i] + pool->width[i]);
+    }
+    queue->tailRight = saved->tailRight;
+}
+
+int saveWorldSnapshot(const GameWorld_s* world, WorldSnapshot_s* snapshot) {
+    if (world->obstacles.count > SNAPSHOT_MAX_OBSTACLES || world->trashBins.count > SNAPSHOT_MAX_TRASH_BINS ||
+        world->thrownTrashItems.count > SNAPSHOT_MAX_THROWN_TRASH) return 0;
+
+    snapshot->gameState = world->gameState;
+    snapshot->player = world->player;
+    savePool(&world->obstacles, &snapshot->obstacles);
+    savePool(&world->trashBins, &snapshot->trashBins);
+    savePool(&world->thrownTrashItems, &snapshot->thrownTrashItems);
+    saveQueue(&world->obstacleQueue, &world->obstacles, &snapshot->obstacleQueue);
+    saveQueue(&world->trashBinQueue, &world->trashBins, &snapshot->trashBinQueue);
+    snapshot->collisionStats = world->collisionStats;
+    snapshot->simTick = world->simTick;
+    snapshot->nextThrownTrashEvent = world->nextThrownTrashEvent;
+    snapshot->gameSeed = world->gameSeed;
+    snapshot->matchIndex = world->matchIndex;
+    snapshot->spawnCounters = world->spawnCounters;
+    snapshot->difficulty = world->difficulty;
+    snapshot->score = world->score;
+    snapshot->lives = world->lives;
+    snapshot->nextLifeScore = world->nextLifeScore;
+    snapshot->currentObstacleSpeed = world->currentObstacleSpeed;
+    snapshot->gameTime = world->gameTime;
+    snapshot->backgroundOffset1 = world->backgroundOffset1;
+    snapshot->backgroundOffset2 = world->backgroundOffset2;
+    snapshot->prevBackgroundOffset1 = world->prevBackgroundOffset1;
+    snapshot->prevBackgroundOffset2 = world->prevBackgroundOffset2;
+    snapshot->playerAnimationTimer = world->playerAnimationTimer;
+    snapshot->currentPlayerRunFrame = world->currentPlayerRunFrame;
+    snapshot->viewWidth = world->viewWidth;
+    return 1;
+}
+
+void restoreWorldSnapshot(GameWorld_s* world, const WorldSnapshot_s* snapshot) {
+    world->gameState = snapshot->gameState;
+    world->player = snapshot->player;
+    restorePool(&world->obstacles, &snapshot->obstacles);
+    restorePool(&world->trashBins, &snapshot->trashBins);
+    restorePool(&world->thrownTrashItems, &snapshot->thrownTrashItems);
+    restoreQueue(&world->obstacleQueue, &world->obstacles, &snapshot->obstacleQueue);
+    restoreQueue(&world->trashBinQueue, &world->trashBins, &snapshot->trashBinQueue);
+    world->collisionStats = snapshot->collisionStats;
+    world->simTick = snapshot->simTick;
+    world->nextThrownTrashEvent = snapshot->nextThrownTrashEvent;
+    world->gameSeed = snapshot->gameSeed;
+    world->matchIndex = snapshot->matchIndex;
+    world->spawnCounters = snapshot->spawnCounters;
+    world->difficulty = snapshot->difficulty;
+    world->score = snapshot->score;
+    world->lives = snapshot->lives;
+    world->nextLifeScore = snapshot->nextLifeScore;
+    world->currentObstacleSpeed = snapshot->currentObstacleSpeed;
+    world->gameTime = snapshot->gameTime;
+    world->backgroundOffset1 = snapshot->backgroundOffset1;
+    world->backgroundOffset2 = snapshot->backgroundOffset2;
+    world->prevBackgroundOffset1 = snapshot->prevBackgroundOffset1;
+    world->prevBackgroundOffset2 = snapshot->prevBackgroundOffset2;
+    world->playerAnimationTimer = snapshot->playerAnimationTimer;
+    world->currentPlayerRunFrame = snapshot->currentPlayerRunFrame;
+    world->viewWidth = snapshot->viewWidth;
+    // A previsão da rolagem é refeita na próxima vez que for usada (uma janela vazia nunca vale).
+    world->forecast.count = 0;
+}
@@ -0,0 +1,78 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include "World.h"
+
+// --- Retrato (Snapshot) do Mundo ---
+// Uma cópia compacta de todo o estado de simulação de um GameWorld_s em uma struct de tamanho fixo,
+// sem ponteiros: pode ser copiada com memcpy, guardada em arrays, gravada em disco ou enviada pela rede.
+// Serve para voltar no tempo (rollback de rede, depurador), e para bots que exploram jogadas
+// clonando o mundo muitas vezes por quadro.
+//
+// Restaurar um retrato e avançar dá exatamente o mesmo resultado que avançar o mundo original:
+// ficam guardados o jogador, os três pools (só os objetos vivos, na mesma ordem), a ordem das filas,
+// os contadores da partida, a dificuldade e o estado do gerador aleatório (semente, partida e índices dos sorteios).
+// A previsão da rolagem (world->forecast) é só um cache e não entra no retrato.
+
+// Quantos objetos de cada pool cabem em um retrato.
+#define SNAPSHOT_MAX_OBSTACLES 16
+#define SNAPSHOT_MAX_TRASH_BINS 16
+#define SNAPSHOT_MAX_THROWN_TRASH 128
+
+// Os objetos vivos de um pool, nas mesmas posições densas [0, count).
+template <typename TypeEnum, int Capacity>
+struct PoolSnapshot_s {
+    int count;
+    float x[Capacity], y[Capacity];
+    float prevX[Capacity], prevY[Capacity];
+    float width[Capacity], height[Capacity];
+    float velocityX[Capacity], velocityY[Capacity];
+    float originX[Capacity], originY[Capacity];
+    long long spawnTick[Capacity];
+    long long eventTick[Capacity];
+    TypeEnum type[Capacity];
+};
+
+// Uma fila de rolagem, guardada pelas posições densas dos objetos (em ordem de X).
+// Handles de objetos já removidos não entram: a fila os descartaria de qualquer forma.
+template <int Capacity>
+struct QueueSnapshot_s {
+    int count;
+    float tailRight;
+    unsigned char order[Capacity];
+};
+
+typedef struct {
+    GameState gameState;
+    Player_s player;
+    PoolSnapshot_s<ObstacleType, SNAPSHOT_MAX_OBSTACLES> obstacles;
+    PoolSnapshot_s<TrashType, SNAPSHOT_MAX_TRASH_BINS> trashBins;
+    PoolSnapshot_s<TrashType, SNAPSHOT_MAX_THROWN_TRASH> thrownTrashItems;
+    QueueSnapshot_s<SNAPSHOT_MAX_OBSTACLES> obstacleQueue;
+    QueueSnapshot_s<SNAPSHOT_MAX_TRASH_BINS> trashBinQueue;
+    CollisionStats_s collisionStats;
+    long long simTick;
+    long long nextThrownTrashEvent;
+    unsigned long long gameSeed;
+    long long matchIndex;
+    SpawnCounters_s spawnCounters;
+    DifficultySettings_s difficulty;
+    int score;
+    int lives;
+    int nextLifeScore;
+    float currentObstacleSpeed;
+    float gameTime;
+    float backgroundOffset1, backgroundOffset2;
+    float prevBackgroundOffset1, prevBackgroundOffset2;
+    float playerAnimationTimer;
+    int currentPlayerRunFrame;
+    int viewWidth;
+} WorldSnapshot_s;
+
+// Copia o estado do mundo para o retrato. Devolve 0 (e não escreve nada) se algum pool
+// tiver mais objetos do que cabe no retrato (ver SNAPSHOT_MAX_*).
+int saveWorldSnapshot(const GameWorld_s* world, WorldSnapshot_s* snapshot);
+// Volta o mundo (já inicializado com initWorld) para o estado do retrato.
+void restoreWorldSnapshot(GameWorld_s* world, const WorldSnapshot_s* snapshot);
+
+#endif // SNAPSHOT_H
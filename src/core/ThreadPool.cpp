@@ -0,0 +1,115 @@
+#include "ThreadPool.h"
+#include <pthread.h>
+#include <stdlib.h>
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <unistd.h>
+#endif
+
+struct ThreadPool_s {
+    pthread_t* workers;     // Threads auxiliares (threadCount - 1; quem chama é a última).
+    int threadCount;
+    pthread_mutex_t lock;
+    pthread_cond_t wake;    // Avisa os auxiliares de que há um novo laço (ou de que devem sair).
+    pthread_cond_t done;    // Avisa quem chamou de que os auxiliares terminaram o laço.
+
+    // Laço atual. 'generation' muda a cada threadPoolRun, para cada auxiliar saber que há trabalho novo.
+    long long generation;
+    ThreadPoolTask task;
+    void* context;
+    int taskCount;
+    int nextTask;           // Próximo índice livre (incrementado atomicamente).
+    int busyWorkers;        // Auxiliares que ainda não terminaram o laço atual.
+    int quit;
+};
+
+// Executa índices livres até acabarem.
+static void runTasks(ThreadPool_s* pool) {
+    for (;;) {
+        int index = __atomic_fetch_add(&pool->nextTask, 1, __ATOMIC_RELAXED);
+        if (index >= pool->taskCount) return;
+        pool->task(pool->context, index);
+    }
+}
+
+static void* workerMain(void* arg) {
+    ThreadPool_s* pool = (ThreadPool_s*)arg;
+    long long seen = 0;
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        while (!pool->quit && pool->generation == seen) pthread_cond_wait(&pool->wake, &pool->lock);
+        if (pool->quit) break;
+        seen = pool->generation;
+        pthread_mutex_unlock(&pool->lock);
+
+        runTasks(pool);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->busyWorkers == 0) pthread_cond_signal(&pool->done);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+int cpuCount() {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    int count = (int)info.dwNumberOfProcessors;
+#else
+    int count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    return count > 0 ? count : 1;
+}
+
+ThreadPool_s* threadPoolCreate(int threadCount) {
+    if (threadCount <= 0) threadCount = cpuCount();
+    ThreadPool_s* pool = (ThreadPool_s*)calloc(1, sizeof(ThreadPool_s));
+    pool->threadCount = threadCount;
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->wake, NULL);
+    pthread_cond_init(&pool->done, NULL);
+    pool->workers = (pthread_t*)malloc(sizeof(pthread_t) * (size_t)threadCount);
+    for (int i = 0; i < threadCount - 1; i++) {
+        pthread_create(&pool->workers[i], NULL, workerMain, pool);
+    }
+    return pool;
+}
+
+int threadPoolSize(const ThreadPool_s* pool) {
+    return pool->threadCount;
+}
+
+void threadPoolRun(ThreadPool_s* pool, int taskCount, ThreadPoolTask task, void* context) {
+    if (taskCount <= 0) return;
+    pthread_mutex_lock(&pool->lock);
+    pool->task = task;
+    pool->context = context;
+    pool->taskCount = taskCount;
+    pool->nextTask = 0;
+    pool->busyWorkers = pool->threadCount - 1;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+
+    runTasks(pool);
+
+    // Espera os auxiliares largarem o laço antes de retornar (o contexto pode sair de escopo).
+    pthread_mutex_lock(&pool->lock);
+    while (pool->busyWorkers > 0) pthread_cond_wait(&pool->done, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+void threadPoolDestroy(ThreadPool_s* pool) {
+    pthread_mutex_lock(&pool->lock);
+    pool->quit = 1;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+    for (int i = 0; i < pool->threadCount - 1; i++) pthread_join(pool->workers[i], NULL);
+    pthread_cond_destroy(&pool->wake);
+    pthread_cond_destroy(&pool->done);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool->workers);
+    free(pool);
+}
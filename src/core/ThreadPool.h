@@ -0,0 +1,23 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+// --- Pool de Threads ---
+// Um conjunto fixo de threads que executa "laços paralelos": a função 'task' é chamada uma vez
+// para cada índice de 0 a taskCount - 1, distribuídos entre as threads (quem termina antes pega
+// o próximo índice livre). A thread que chama threadPoolRun também trabalha e só retorna quando
+// todos os índices foram executados.
+// Usado para avançar muitos mundos independentes (GameWorld_s) ao mesmo tempo: cada índice
+// cuida de um mundo, e dois índices nunca mexem no mesmo mundo.
+
+typedef void (*ThreadPoolTask)(void* context, int index);
+
+typedef struct ThreadPool_s ThreadPool_s; // Estrutura opaca (definida em ThreadPool.cpp).
+
+ThreadPool_s* threadPoolCreate(int threadCount); // Total de threads, contando quem chama (0 = uma por núcleo).
+int threadPoolSize(const ThreadPool_s* pool);    // Quantas threads trabalham em cada threadPoolRun.
+void threadPoolRun(ThreadPool_s* pool, int taskCount, ThreadPoolTask task, void* context); // Executa e espera.
+void threadPoolDestroy(ThreadPool_s* pool);      // Encerra as threads e libera o pool.
+
+int cpuCount();                                  // Núcleos disponíveis na máquina (pelo menos 1).
+
+#endif // THREADPOOL_H
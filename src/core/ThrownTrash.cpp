@@ -0,0 +1,290 @@
+#include "ThrownTrash.h"
+#include "World.h"
+#include "Config.h"
+#include "SimdKernels.h"
+#include <stdlib.h>
+#include <limits.h>
+#include <math.h>
+
+// Mesma gravidade usada antes na integração passo a passo do lixo.
+static const float TRASH_GRAVITY = GRAVITY * 0.35f;
+
+// Posição do item 'i' depois de 'age' passos desde o lançamento.
+static float trashXAt(const GameWorld_s* world, int i, long long age) {
+    return world->thrownTrashItems.originX[i] + world->thrownTrashItems.velocityX[i] * (float)age;
+}
+
+static float trashYAt(const GameWorld_s* world, int i, long long age) {
+    double a = (double)age;
+    return (float)(world->thrownTrashItems.originY[i] + world->thrownTrashItems.velocityY[i] * a - TRASH_GRAVITY * a * (a - 1.0) / 2.0);
+}
+
+static int isOutOfScreen(const GameWorld_s* world, float x, float y) {
+    return y < -50 || x > world->viewWidth + 50;
+}
+
+// --- Lotes de Alvos ---
+// Alvos (monstros ou lixeiras) em colunas, no formato do kernel overlapBoxes.
+typedef struct {
+    float left[OVERLAP_BATCH_MAX], right[OVERLAP_BATCH_MAX];
+    float bottom[OVERLAP_BATCH_MAX], top[OVERLAP_BATCH_MAX];
+    int index[OVERLAP_BATCH_MAX]; // Posição do alvo no pool.
+    int count;
+} TargetBatch_s;
+
+static void addBatchTarget(TargetBatch_s* batch, int index, float left, float right, float bottom, float top) {
+    int n = batch->count++;
+    batch->index[n] = index;
+    batch->left[n] = left;     batch->right[n] = right;
+    batch->bottom[n] = bottom; batch->top[n] = top;
+}
+
+/**
+ * Testa a caixa do item contra todo o lote de uma vez (ver overlapBoxes) e esvazia o lote.
+ * Devolve o menor índice atingido entre 'firstHit' e os alvos do lote (-1 se nenhum):
+ * vale o primeiro alvo, na ordem do pool, como no laço de colisão original.
+ */
+static int firstHitInBatch(GameWorld_s* world, TargetBatch_s* batch, int firstHit, float left, float right, float bottom, float top) {
+    if (batch->count == 0) return firstHit;
+    unsigned int mask = overlapBoxes(left, right, bottom, top, batch->left, batch->right, batch->bottom, batch->top, batch->count);
+    world->collisionStats.pairsTested += batch->count;
+    world->collisionStats.pairsHit += __builtin_popcount(mask);
+    for (; mask != 0; mask &= mask - 1) {
+        int k = batch->index[__builtin_ctz(mask)]; // Bit ligado de menor ordem.
+        if (firstHit < 0 || k < firstHit) firstHit = k;
+    }
+    batch->count = 0;
+    return firstHit;
+}
+
+static int isMonster(const GameWorld_s* world, int k) {
+    return world->obstacles.type[k] == MONSTER || world->obstacles.type[k] == FLYING_MONSTER;
+}
+
+int findThrownTrashHit(GameWorld_s* world, int i, int* monster, int* bin) {
+    float left = world->thrownTrashItems.x[i], right = world->thrownTrashItems.x[i] + world->thrownTrashItems.width[i];
+    float bottom = world->thrownTrashItems.y[i], top = world->thrownTrashItems.y[i] + world->thrownTrashItems.height[i];
+    TargetBatch_s batch;
+    batch.count = 0;
+
+    *monster = -1;
+    for (int k = 0; k < world->obstacles.count; k++) {
+        if (!isMonster(world, k)) continue; // Só os monstros interagem com o lixo arremessado.
+        addBatchTarget(&batch, k, world->obstacles.x[k], world->obstacles.x[k] + world->obstacles.width[k],
+                       world->obstacles.y[k], world->obstacles.y[k] + world->obstacles.height[k]);
+        if (batch.count == OVERLAP_BATCH_MAX) *monster = firstHitInBatch(world, &batch, *monster, left, right, bottom, top);
+    }
+    *monster = firstHitInBatch(world, &batch, *monster, left, right, bottom, top);
+
+    *bin = -1;
+    for (int j = 0; j < world->trashBins.count; j++) {
+        addBatchTarget(&batch, j, world->trashBins.x[j], world->trashBins.x[j] + world->trashBins.width[j],
+                       world->trashBins.y[j], world->trashBins.y[j] + world->trashBins.height[j]);
+        if (batch.count == OVERLAP_BATCH_MAX) *bin = firstHitInBatch(world, &batch, *bin, left, right, bottom, top);
+    }
+    *bin = firstHitInBatch(world, &batch, *bin, left, right, bottom, top);
+    return *monster >= 0 || *bin >= 0;
+}
+
+// --- Previsão ---
+// Velocidade da rolagem em cada passo, calculada com as mesmas operações em float de step()
+// (então as posições previstas são idênticas às reais). Ela só depende do tempo de jogo, então
+// vale para todos os itens e alvos: fica guardada em uma janela de passos [base + 1, base + count]
+// (world->forecast, ver World.h) que só é refeita quando a previsão precisa ir além dela.
+#define FORECAST_SLACK 1024 // Passos extras calculados a cada vez que a janela é refeita.
+
+// Parte da janela que começa no passo atual: speed[0] e shift[0] são do passo simTick + 1.
+typedef struct {
+    const float* speed;
+    const double* shift;
+    double shiftOrigin; // Soma acumulada até o passo atual, a descontar de shift[].
+} ScrollForecast_s;
+
+static void ensureForecast(GameWorld_s* world, int ticks) {
+    ScrollForecastCache_s* cache = &world->forecast;
+    long long offset = world->simTick - cache->base;
+    // A janela vale se cobre os passos pedidos e continua com a velocidade atual. Uma janela
+    // vazia nunca vale (initGame e restoreWorldSnapshot a esvaziam).
+    if (offset >= 0 && offset + ticks < cache->count &&
+        cache->obstacleSpeedAt[offset] == world->currentObstacleSpeed) return;
+
+    int count = ticks + FORECAST_SLACK;
+    if (count > cache->capacity) {
+        cache->capacity = count;
+        cache->obstacleSpeedAt = (float*)realloc(cache->obstacleSpeedAt, sizeof(float) * cache->capacity);
+        cache->binSpeedAt = (float*)realloc(cache->binSpeedAt, sizeof(float) * cache->capacity);
+        cache->obstacleShiftAt = (double*)realloc(cache->obstacleShiftAt, sizeof(double) * cache->capacity);
+        cache->binShiftAt = (double*)realloc(cache->binShiftAt, sizeof(double) * cache->capacity);
+    }
+    // Refaz a sequência desde o passo atual: tempo += passo; rola com a velocidade; acelera.
+    float time = world->gameTime;
+    float speed = world->currentObstacleSpeed;
+    double obstacleShift = 0.0, binShift = 0.0;
+    for (int n = 0; n < count; n++) {
+        time += SIM_TICK_SECONDS;
+        cache->obstacleSpeedAt[n] = speed;
+        cache->binSpeedAt[n] = speed * 0.90f;
+        obstacleShift += cache->obstacleSpeedAt[n];
+        binShift += cache->binSpeedAt[n];
+        cache->obstacleShiftAt[n] = obstacleShift;
+        cache->binShiftAt[n] = binShift;
+        speed += time * world->difficulty.speedRamp;
+    }
+    cache->base = world->simTick;
+    cache->count = count;
+}
+
+static ScrollForecast_s forecastFrom(const GameWorld_s* world, const float* speedAt, const double* shiftAt) {
+    long long offset = world->simTick - world->forecast.base;
+    ScrollForecast_s forecast;
+    forecast.speed = speedAt + offset;
+    forecast.shift = shiftAt + offset;
+    forecast.shiftOrigin = offset > 0 ? shiftAt[offset - 1] : 0.0;
+    return forecast;
+}
+
+static int isOutOfScreenAt(const GameWorld_s* world, int i, long long age) {
+    return isOutOfScreen(world, trashXAt(world, i, age), trashYAt(world, i, age));
+}
+
+/**
+ * Passo em que o item 'i' sai da tela (a partir do passo atual, inclusive).
+ * O X só cresce e o Y, depois do topo da parábola, só diminui: uma vez fora, o item não volta.
+ * A estimativa pela fórmula é só um ponto de partida; o teste exato decide o passo.
+ */
+static long long exitTick(GameWorld_s* world, int i) {
+    long long age = world->simTick - world->thrownTrashItems.spawnTick[i];
+    double vx = world->thrownTrashItems.velocityX[i], vy = world->thrownTrashItems.velocityY[i], g = TRASH_GRAVITY;
+    // x(a) > largura + 50  =>  a > (largura + 50 - x0) / vx
+    double ax = (world->viewWidth + 50 - world->thrownTrashItems.originX[i]) / vx;
+    // y(a) < -50  =>  (g/2) a^2 - (vy + g/2) a - (y0 + 50) > 0  (raiz positiva da equação)
+    double b = vy + g / 2.0, c = world->thrownTrashItems.originY[i] + 50.0;
+    double ay = (b + sqrt(b * b + 2.0 * g * c)) / g;
+    long long estimate = (long long)(ax < ay ? ax : ay) - 2;
+
+    long long a = estimate > age ? estimate : age;
+    while (a > age && isOutOfScreenAt(world, i, a - 1)) a--;
+    while (!isOutOfScreenAt(world, i, a)) a++;
+    return world->thrownTrashItems.spawnTick[i] + a;
+}
+
+/**
+ * Primeiro passo, antes de 'limitTick', em que o item 'i' atinge um alvo que está agora em
+ * (x, y, width, height) e rola conforme 'forecast'. Devolve 'limitTick' se não houver acerto.
+ * O alvo só anda para a esquerda e o item só para a direita: depois que o alvo passa
+ * inteiramente pelo item, não há mais o que testar.
+ */
+static long long firstHitTick(GameWorld_s* world, int i, float x, float y, float width, float height, const ScrollForecast_s* forecast,
+                              int checkCurrentHits, long long limitTick) {
+    world->collisionStats.pairsPredicted++;
+    float itemWidth = world->thrownTrashItems.width[i], itemHeight = world->thrownTrashItems.height[i];
+    // Descarte rápido: se no último passo possível o alvo ainda está à direita do item
+    // (com folga para o arredondamento da soma), ele nunca é alcançado.
+    long long last = limitTick - 1;
+    if (last > world->simTick) {
+        double lastX = x - (forecast->shift[last - world->simTick - 1] - forecast->shiftOrigin);
+        if (lastX > trashXAt(world, i, last - world->thrownTrashItems.spawnTick[i]) + itemWidth + 1.0) return limitTick;
+    }
+    float top = y + height;
+    for (long long tick = world->simTick; tick < limitTick; tick++) {
+        if (tick > world->simTick) x -= forecast->speed[tick - world->simTick - 1];
+        long long age = tick - world->thrownTrashItems.spawnTick[i];
+        float itemLeft = trashXAt(world, i, age);
+        if (itemLeft >= x + width) break; // O alvo já passou.
+        if (tick == world->simTick && !checkCurrentHits) continue;
+        // Mesmo teste da caixa de colisão, na mesma ordem.
+        if (itemLeft + itemWidth > x) {
+            float itemBottom = trashYAt(world, i, age);
+            if (itemBottom + itemHeight > y && itemBottom < top) {
+                world->collisionStats.hitsPredicted++;
+                return tick;
+            }
+        }
+    }
+    return limitTick;
+}
+
+static void setEventTick(GameWorld_s* world, int i, long long tick) {
+    world->thrownTrashItems.eventTick[i] = tick;
+    if (tick < world->nextThrownTrashEvent) world->nextThrownTrashEvent = tick;
+}
+
+void scheduleThrownTrash(GameWorld_s* world, int i, int checkCurrentHits) {
+    // Sem a previsão, todo item é tratado no passo seguinte (ou neste, se os acertos dele contam).
+    if (world->thrownTrashEveryTick) {
+        setEventTick(world, i, checkCurrentHits ? world->simTick : world->simTick + 1);
+        return;
+    }
+    // Sair da tela vem antes dos acertos no mesmo passo (como em step()), então o limite
+    // para procurar acertos é o passo de saída.
+    long long eventTick = exitTick(world, i);
+    ensureForecast(world, (int)(eventTick - world->simTick));
+    ScrollForecast_s obstacleForecast = forecastFrom(world, world->forecast.obstacleSpeedAt, world->forecast.obstacleShiftAt);
+    ScrollForecast_s binForecast = forecastFrom(world, world->forecast.binSpeedAt, world->forecast.binShiftAt);
+    for (int k = 0; k < world->obstacles.count; k++) {
+        if (!isMonster(world, k)) continue;
+        eventTick = firstHitTick(world, i, world->obstacles.x[k], world->obstacles.y[k], world->obstacles.width[k], world->obstacles.height[k],
+                                 &obstacleForecast, checkCurrentHits, eventTick);
+    }
+    for (int j = 0; j < world->trashBins.count; j++) {
+        eventTick = firstHitTick(world, i, world->trashBins.x[j], world->trashBins.y[j], world->trashBins.width[j], world->trashBins.height[j],
+                                 &binForecast, checkCurrentHits, eventTick);
+    }
+    setEventTick(world, i, eventTick);
+}
+
+void rescheduleAllThrownTrash(GameWorld_s* world, int checkCurrentHits) {
+    world->nextThrownTrashEvent = LLONG_MAX;
+    for (int i = 0; i < world->thrownTrashItems.count; i++) scheduleThrownTrash(world, i, checkCurrentHits);
+}
+
+// Maior passo de evento entre os itens: até onde as velocidades previstas precisam ir.
+static long long latestEventTick(const GameWorld_s* world) {
+    long long latest = world->simTick;
+    for (int i = 0; i < world->thrownTrashItems.count; i++) {
+        if (world->thrownTrashItems.eventTick[i] > latest) latest = world->thrownTrashItems.eventTick[i];
+    }
+    return latest;
+}
+
+// Um alvo novo só pode antecipar o evento de um item: basta testá-lo contra cada item.
+static void scheduleAgainstNewTarget(GameWorld_s* world, float x, float y, float width, float height,
+                                     const ScrollForecast_s* forecast, long long latestTick) {
+    // Antes de sair da tela, nenhum item passa de largura + 50: se até o último evento o alvo
+    // ainda estiver além disso, nenhum item o alcança (o caso comum, já que ele nasce bem à direita).
+    if (latestTick > world->simTick &&
+        x - (forecast->shift[latestTick - world->simTick - 1] - forecast->shiftOrigin) > world->viewWidth + 50 + world->thrownTrashItems.width[0] + 1.0) return;
+    for (int i = 0; i < world->thrownTrashItems.count; i++) {
+        long long tick = firstHitTick(world, i, x, y, width, height, forecast, 1, world->thrownTrashItems.eventTick[i]);
+        if (tick < world->thrownTrashItems.eventTick[i]) setEventTick(world, i, tick);
+    }
+}
+
+void thrownTrashObstacleAdded(GameWorld_s* world, int k) {
+    if (world->thrownTrashItems.count == 0 || world->thrownTrashEveryTick || !isMonster(world, k)) return;
+    long long latest = latestEventTick(world);
+    ensureForecast(world, (int)(latest - world->simTick));
+    ScrollForecast_s forecast = forecastFrom(world, world->forecast.obstacleSpeedAt, world->forecast.obstacleShiftAt);
+    scheduleAgainstNewTarget(world, world->obstacles.x[k], world->obstacles.y[k], world->obstacles.width[k], world->obstacles.height[k], &forecast, latest);
+}
+
+void thrownTrashBinAdded(GameWorld_s* world, int j) {
+    if (world->thrownTrashItems.count == 0 || world->thrownTrashEveryTick) return;
+    long long latest = latestEventTick(world);
+    ensureForecast(world, (int)(latest - world->simTick));
+    ScrollForecast_s forecast = forecastFrom(world, world->forecast.binSpeedAt, world->forecast.binShiftAt);
+    scheduleAgainstNewTarget(world, world->trashBins.x[j], world->trashBins.y[j], world->trashBins.width[j], world->trashBins.height[j], &forecast, latest);
+}
+
+void updateThrownTrashPosition(GameWorld_s* world, int i) {
+    long long age = world->simTick - world->thrownTrashItems.spawnTick[i];
+    long long prevAge = age > 0 ? age - 1 : 0;
+    world->thrownTrashItems.x[i] = trashXAt(world, i, age);
+    world->thrownTrashItems.y[i] = trashYAt(world, i, age);
+    world->thrownTrashItems.prevX[i] = trashXAt(world, i, prevAge);
+    world->thrownTrashItems.prevY[i] = trashYAt(world, i, prevAge);
+}
+
+void updateThrownTrashPositions(GameWorld_s* world) {
+    for (int i = 0; i < world->thrownTrashItems.count; i++) updateThrownTrashPosition(world, i);
+}
@@ -0,0 +1,41 @@
+#ifndef THROWNTRASH_H
+#define THROWNTRASH_H
+
+#include "World.h"
+
+// --- Trajetória do Lixo Arremessado em Forma Fechada ---
+// O lixo segue sempre a mesma parábola: a cada passo anda TRASH_ITEM_SPEED_X na horizontal,
+// e a velocidade vertical começa em TRASH_ITEM_INITIAL_SPEED_Y e perde GRAVITY * 0.35f.
+// Então a posição depois de 'a' passos tem fórmula direta:
+//     x(a) = x0 + vx * a
+//     y(a) = y0 + vy * a - g * a * (a - 1) / 2
+// Os alvos (monstros e lixeiras) também andam de forma conhecida: a velocidade da rolagem
+// só depende do tempo de jogo. Com isso, no momento do arremesso já dá para calcular em que passo
+// o item vai acertar algo ou sair da tela (o "evento" do item). Entre o lançamento e o evento
+// o item não custa nada por passo: nem movimento, nem teste de colisão.
+//
+// A previsão só muda quando os alvos mudam de um jeito imprevisível (um obstáculo reciclado
+// com tipo sorteado, um monstro destruído, um obstáculo jogado para longe após atingir o jogador).
+// Um alvo novo só pode antecipar eventos (thrownTrashObstacleAdded/thrownTrashBinAdded); quando
+// um alvo some, os eventos são recalculados a partir do passo atual (rescheduleAllThrownTrash).
+
+// Calcula o evento do item 'i' a partir do passo atual (simTick). Se 'checkCurrentHits' for 0,
+// acertos no passo atual são ignorados (apenas a saída da tela é verificada nele).
+void scheduleThrownTrash(GameWorld_s* world, int i, int checkCurrentHits);
+// Recalcula o evento de todos os itens (ver scheduleThrownTrash).
+void rescheduleAllThrownTrash(GameWorld_s* world, int checkCurrentHits);
+// Um obstáculo (posição k) ou uma lixeira (posição j) acabou de ser reposicionado à frente:
+// antecipa o evento dos itens que vão atingi-lo antes do previsto.
+void thrownTrashObstacleAdded(GameWorld_s* world, int k);
+void thrownTrashBinAdded(GameWorld_s* world, int j);
+
+// Procura o primeiro monstro e a primeira lixeira que o item 'i' atinge nas posições atuais
+// (menor índice do pool, -1 se nenhum). Devolve 1 se houve algum acerto.
+int findThrownTrashHit(GameWorld_s* world, int i, int* monster, int* bin);
+
+// Atualiza x/y (e a posição anterior, para a interpolação) do item 'i', ou de todos, no passo atual.
+// Só é necessário para desenhar e para tratar os eventos.
+void updateThrownTrashPosition(GameWorld_s* world, int i);
+void updateThrownTrashPositions(GameWorld_s* world);
+
+#endif // THROWNTRASH_H
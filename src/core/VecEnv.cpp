@@ -0,0 +1,166 @@
+#include "VecEnv.h"
+#include "GameLogic.h"
+#include "Player.h"
+#include "SimdKernels.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Mundos por tarefa do pool de threads: blocos grandes o bastante para que a distribuição
+// dos índices não pese, e pequenos o bastante para equilibrar a carga entre as threads.
+#define VEC_ENV_CHUNK 64
+
+/**
+ * Escreve em 'out' os 'seen' objetos da fila que ainda estão à frente do jogador (borda direita
+ * depois do jogador), do mais próximo ao mais distante. Cada objeto ocupa 'stride' floats, e as
+ * posições sem objeto recebem -1 no tipo (última posição) e 0 no resto.
+ */
+template <typename TypeEnum>
+static void writeAhead(const GameWorld_s* world, const EntityPool_s<TypeEnum>* pool, const ScrollQueue_s* queue,
+                       float* out, int seen, int stride) {
+    float playerX = world->player.x;
+    int written = 0;
+    // A fila está em ordem de X: basta percorrê-la do início e parar quando já há objetos suficientes.
+    for (int q = 0; q < queue->count && written < seen; q++) {
+        int i = poolIndexOf(pool, queue->entries[(queue->head + q) & (queue->capacity - 1)]);
+        if (i < 0) continue; // Handle de um objeto removido (ex.: monstro destruído).
+        if (pool->x[i] + pool->width[i] < playerX) continue; // Já ficou para trás.
+        float* o = out + written * stride;
+        o[0] = pool->x[i] - playerX;
+        if (stride == 5) {
+            o[1] = pool->y[i];
+            o[2] = pool->width[i];
+            o[3] = pool->height[i];
+        }
+        o[stride - 1] = (float)pool->type[i];
+        written++;
+    }
+    for (; written < seen; written++) {
+        float* o = out + written * stride;
+        for (int c = 0; c < stride - 1; c++) o[c] = 0.0f;
+        o[stride - 1] = -1.0f;
+    }
+}
+
+/**
+ * Escreve a observação do mundo (ver VEC_ENV_OBS_SIZE em VecEnv.h).
+ */
+static void writeObservation(const GameWorld_s* world, float* out) {
+    const Player_s* player = &world->player;
+    out[0] = player->y - GROUND_LEVEL;
+    out[1] = player->jumpVelocity;
+    out[2] = (float)player->jumping;
+    out[3] = (float)player->ducking;
+    out[4] = (float)player->selectedTrash;
+    out[5] = world->currentObstacleSpeed;
+    out[6] = (float)world->lives;
+    out += VEC_ENV_PLAYER_OBS;
+    writeAhead(world, &world->obstacles, &world->obstacleQueue, out, VEC_ENV_OBSTACLES_SEEN, 5);
+    out += 5 * VEC_ENV_OBSTACLES_SEEN;
+    writeAhead(world, &world->trashBins, &world->trashBinQueue, out, VEC_ENV_BINS_SEEN, 2);
+}
+
+/**
+ * Começa uma partida nova no mundo k e escreve a sua observação.
+ */
+static void resetWorld(VecEnv_s* env, int k) {
+    GameWorld_s* world = &env->worlds[k];
+    initGame(world);
+    env->lastScore[k] = world->score;
+    env->lastLives[k] = world->lives;
+    writeObservation(world, env->observations + (size_t)k * VEC_ENV_OBS_SIZE);
+}
+
+/**
+ * Aplica a ação ao mundo, como os callbacks de Input.cpp fariam com as teclas e o mouse.
+ */
+static void applyAction(GameWorld_s* world, unsigned char action) {
+    if (action & VEC_ENV_CYCLE_TRASH) cycleSelectedTrash(world);
+    if (action & VEC_ENV_THROW) spawnThrownTrashItem(world);
+    if (action & VEC_ENV_JUMP) playerJump(world);
+    // Agachar é "segurar a tecla": sem o bit, o jogador levanta (se estava agachado).
+    if (action & VEC_ENV_DUCK) playerSetDucking(world, 1);
+    else if (world->player.ducking) playerSetDucking(world, 0);
+}
+
+/**
+ * Avança um bloco de VEC_ENV_CHUNK mundos. Executada pelas threads do pool: cada bloco
+ * só toca os seus próprios mundos e as suas próprias posições dos buffers.
+ */
+static void stepChunk(void* context, int index) {
+    VecEnv_s* env = (VecEnv_s*)context;
+    int first = index * VEC_ENV_CHUNK;
+    int last = first + VEC_ENV_CHUNK;
+    if (last > env->count) last = env->count;
+
+    for (int k = first; k < last; k++) {
+        GameWorld_s* world = &env->worlds[k];
+        applyAction(world, env->actions[k]);
+        step(world);
+
+        env->rewards[k] = (float)(world->score - env->lastScore[k]) +
+                          VEC_ENV_LIFE_REWARD * (float)(world->lives - env->lastLives[k]);
+        if (world->gameState == GAME_OVER) {
+            env->dones[k] = 1;
+            env->episodeCounts[k]++;
+            resetWorld(env, k);
+        } else {
+            env->dones[k] = 0;
+            env->lastScore[k] = world->score;
+            env->lastLives[k] = world->lives;
+            writeObservation(world, env->observations + (size_t)k * VEC_ENV_OBS_SIZE);
+        }
+    }
+}
+
+VecEnv_s* vecEnvCreate(int count, unsigned long long seed, int threads) {
+    if (count < 1) count = 1;
+    // O nível SIMD é o único estado global do núcleo: escolhido antes de existirem threads.
+    getSimdLevel();
+
+    VecEnv_s* env = (VecEnv_s*)calloc(1, sizeof(VecEnv_s));
+    env->count = count;
+    env->worlds = (GameWorld_s*)calloc((size_t)count, sizeof(GameWorld_s));
+    env->observations = (float*)calloc((size_t)count * VEC_ENV_OBS_SIZE, sizeof(float));
+    env->rewards = (float*)calloc((size_t)count, sizeof(float));
+    env->dones = (unsigned char*)calloc((size_t)count, sizeof(unsigned char));
+    env->episodeCounts = (long long*)calloc((size_t)count, sizeof(long long));
+    env->lastScore = (int*)calloc((size_t)count, sizeof(int));
+    env->lastLives = (int*)calloc((size_t)count, sizeof(int));
+    env->pool = threadPoolCreate(threads);
+
+    for (int k = 0; k < count; k++) {
+        initWorld(&env->worlds[k]);
+        env->worlds[k].logMessages = 0;
+        setGameSeed(&env->worlds[k], seed + (unsigned long long)k);
+    }
+    vecEnvReset(env);
+    return env;
+}
+
+void vecEnvReset(VecEnv_s* env) {
+    for (int k = 0; k < env->count; k++) {
+        resetWorld(env, k);
+        env->rewards[k] = 0.0f;
+        env->dones[k] = 0;
+    }
+}
+
+void vecEnvStep(VecEnv_s* env, const unsigned char* actions) {
+    env->actions = actions;
+    int chunks = (env->count + VEC_ENV_CHUNK - 1) / VEC_ENV_CHUNK;
+    threadPoolRun(env->pool, chunks, stepChunk, env);
+    env->actions = NULL;
+}
+
+void vecEnvDestroy(VecEnv_s* env) {
+    for (int k = 0; k < env->count; k++) freeWorld(&env->worlds[k]);
+    free(env->worlds);
+    free(env->observations);
+    free(env->rewards);
+    free(env->dones);
+    free(env->episodeCounts);
+    free(env->lastScore);
+    free(env->lastLives);
+    threadPoolDestroy(env->pool);
+    free(env);
+}
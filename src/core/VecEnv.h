@@ -0,0 +1,63 @@
+#ifndef VECENV_H
+#define VECENV_H
+
+#include "World.h"
+#include "ThreadPool.h"
+
+// --- Ambientes Vetorizados (para treinar agentes) ---
+// Avança K mundos (GameWorld_s) em conjunto: a cada vecEnvStep, cada mundo recebe uma ação,
+// anda um passo e escreve a sua observação, recompensa e fim de partida em buffers contínuos.
+// Os buffers são alocados uma única vez em vecEnvCreate; nenhum passo aloca memória.
+//
+// O mundo k usa a semente seed + k, então o resultado não depende do número de threads.
+// Quando uma partida acaba (GAME_OVER), o mundo recomeça na hora com initGame: 'dones[k]' fica 1,
+// 'rewards[k]' é a recompensa do último passo da partida e a observação já é a da partida nova.
+
+// Bits da ação de cada mundo. Espelham os controles da janela (Input.cpp).
+enum VecEnvAction {
+    VEC_ENV_JUMP        = 1, // Tecla W / seta para cima.
+    VEC_ENV_DUCK        = 2, // Tecla S / seta para baixo segurada (sem o bit, o jogador levanta).
+    VEC_ENV_THROW       = 4, // Clique esquerdo: arremessa o lixo selecionado.
+    VEC_ENV_CYCLE_TRASH = 8  // Clique direito: troca o tipo de lixo (antes do arremesso do mesmo passo).
+};
+
+// Quantos obstáculos e lixeiras à frente do jogador entram na observação.
+#define VEC_ENV_OBSTACLES_SEEN 3
+#define VEC_ENV_BINS_SEEN 3
+
+// Observação de um mundo (floats, em pixels e passos do jogo):
+//   [0..6]  jogador: altura acima do chão, velocidade vertical, pulando, agachado, lixo selecionado,
+//           velocidade atual dos obstáculos, vidas.
+//   depois, para cada obstáculo à frente (do mais próximo ao mais distante):
+//           distância horizontal até o jogador, y, largura, altura, tipo (-1 = não há obstáculo).
+//   depois, para cada lixeira à frente: distância horizontal, tipo (-1 = não há lixeira).
+#define VEC_ENV_PLAYER_OBS 7
+#define VEC_ENV_OBS_SIZE (VEC_ENV_PLAYER_OBS + 5 * VEC_ENV_OBSTACLES_SEEN + 2 * VEC_ENV_BINS_SEEN)
+
+// Recompensa por passo: pontos ganhos + VEC_ENV_LIFE_REWARD por vida ganha (negativa se perdeu).
+#define VEC_ENV_LIFE_REWARD 100.0f
+
+typedef struct {
+    int count;                   // Número de mundos (K).
+    GameWorld_s* worlds;         // [K] mundos.
+    float* observations;         // [K * VEC_ENV_OBS_SIZE] observação do mundo k em observations + k * VEC_ENV_OBS_SIZE.
+    float* rewards;              // [K] recompensa do último passo.
+    unsigned char* dones;        // [K] 1 se a partida do mundo acabou no último passo (e foi reiniciada).
+    long long* episodeCounts;    // [K] partidas encerradas por mundo.
+    int* lastScore;              // [K] pontuação antes do passo (para a recompensa).
+    int* lastLives;              // [K] vidas antes do passo.
+    const unsigned char* actions; // Ações do vecEnvStep em andamento.
+    ThreadPool_s* pool;          // Threads que avançam os blocos de mundos.
+} VecEnv_s;
+
+// Cria K mundos já em partida (mundo k com a semente seed + k) e escreve as observações iniciais.
+// 'threads' segue threadPoolCreate (0 = uma por núcleo, 1 = sem threads extras).
+VecEnv_s* vecEnvCreate(int count, unsigned long long seed, int threads);
+// Recomeça a partida de todos os mundos e reescreve as observações.
+void vecEnvReset(VecEnv_s* env);
+// Aplica actions[k] (bits de VecEnvAction) ao mundo k e avança todos um passo.
+void vecEnvStep(VecEnv_s* env, const unsigned char* actions);
+// Libera os mundos, os buffers e as threads.
+void vecEnvDestroy(VecEnv_s* env);
+
+#endif // VECENV_H
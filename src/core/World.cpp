@@ -0,0 +1,54 @@
+#include "World.h"
+#include "ThrownTrash.h"
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * Estado de um mundo recém-criado: no MENU, com a largura padrão da janela.
+ * Pools e filas zerados já são estruturas vazias válidas (ver Pool.h e ScrollQueue.h).
+ */
+void initWorld(GameWorld_s* world) {
+    memset(world, 0, sizeof(*world));
+    world->gameState = MENU;
+    world->nextThrownTrashEvent = LLONG_MAX;
+    world->gameSeed = 1;
+    world->matchIndex = -1;
+    world->lives = 3;
+    world->nextLifeScore = 2000;
+    world->currentObstacleSpeed = OBSTACLE_SPEED_BASE;
+    world->difficulty.speedRamp = OBSTACLE_SPEED_RAMP;
+    world->difficulty.minObstacleSpacing = MIN_OBSTACLE_SPACING;
+    world->difficulty.randObstacleSpacing = RAND_OBSTACLE_SPACING;
+    world->difficulty.minTrashBinSpacing = MIN_TRASHBIN_SPACING;
+    world->difficulty.randTrashBinSpacing = RAND_TRASHBIN_SPACING;
+    world->viewWidth = WINDOW_WIDTH;
+    world->backgroundOffset2 = WINDOW_WIDTH;
+    world->prevBackgroundOffset2 = WINDOW_WIDTH;
+    world->logMessages = 1;
+}
+
+void freeWorld(GameWorld_s* world) {
+    poolFree(&world->obstacles);
+    poolFree(&world->trashBins);
+    poolFree(&world->thrownTrashItems);
+    scrollQueueFree(&world->obstacleQueue);
+    scrollQueueFree(&world->trashBinQueue);
+    free(world->forecast.obstacleSpeedAt);
+    free(world->forecast.binSpeedAt);
+    free(world->forecast.obstacleShiftAt);
+    free(world->forecast.binShiftAt);
+    free(world->thrownTrashHits.items);
+    free(world->thrownTrashHits.monsters);
+    free(world->thrownTrashHits.bins);
+    memset(world, 0, sizeof(*world));
+}
+
+void setWorldViewWidth(GameWorld_s* world, int width) {
+    world->viewWidth = width;
+    // A largura define onde o lixo arremessado sai da tela: os passos previstos mudam.
+    rescheduleAllThrownTrash(world, 0);
+}
+
+// Array de strings usado para exibir o nome do lixo selecionado no HUD (Heads-Up Display).
+const char* TRASH_TYPE_NAMES[TRASH_TYPE_COUNT] = {"Papel", "Vidro", "Plastico", "Metal", "Organico"};
@@ -0,0 +1,138 @@
+#ifndef WORLD_H
+#define WORLD_H
+
+#include "Config.h"
+#include "Pool.h"
+#include "ScrollQueue.h"
+
+// --- Estado da Simulação ---
+// Este cabeçalho faz parte do núcleo (core) do jogo: não depende de OpenGL nem de GLUT,
+// para que a lógica possa rodar tanto na janela quanto no simulador sem tela (ecorunner-sim).
+
+// --- Estruturas de Dados (Structs) ---
+// Agrupam múltiplas variáveis em um único tipo de dado.
+
+// Define a estrutura de dados para o jogador.
+typedef struct {
+    float x, y;
+    float prevX, prevY; // Posição no passo anterior, usada para interpolar o desenho.
+    float width, height;
+    int jumping;
+    float jumpVelocity;
+    int ducking;
+    TrashType selectedTrash;
+} Player_s;
+
+// --- Pools dos objetos do cenário ---
+// Cada tipo de objeto vive em um EntityPool_s (ver Pool.h): uma estrutura de arrays densa,
+// em que os objetos vivos ocupam as posições [0, count) e a capacidade cresce sob demanda.
+typedef EntityPool_s<ObstacleType> Obstacles_s; // Obstáculos do jogo.
+typedef EntityPool_s<TrashType> TrashBins_s;    // Lixeiras.
+typedef EntityPool_s<TrashType> TrashItems_s;   // Lixo arremessado.
+
+// Estatísticas de colisão do lixo arremessado, acumuladas desde a criação do mundo.
+// A previsão dos eventos (ver ThrownTrash.h) e a confirmação no passo do evento são contadas
+// separadamente: um mesmo par costuma passar pelas duas.
+typedef struct {
+    long long pairsTested;    // Pares (item, alvo) que passaram pelo teste completo da caixa no passo do evento.
+    long long pairsHit;       // Pares que realmente se sobrepunham.
+    long long pairsPredicted; // Pares (item, alvo) cuja trajetória foi percorrida pela previsão.
+    long long hitsPredicted;  // Acertos encontrados pela previsão.
+} CollisionStats_s;
+
+
+// Quantos objetos de cada tipo já foram posicionados na partida. É o índice do próximo sorteio
+// de cada fluxo do gerador aleatório (ver Random.h): o N-ésimo obstáculo sempre tem o mesmo
+// tipo e espaçamento para a mesma semente e partida, não importa o que aconteceu antes.
+typedef struct {
+    long long obstacles;   // Obstáculos posicionados (criados ou reciclados).
+    long long trashBins;   // Lixeiras posicionadas.
+    long long relocations; // Obstáculos jogados para longe após atingir o jogador.
+} SpawnCounters_s;
+
+
+// Parâmetros de dificuldade do mundo. initWorld usa os valores de Config.h; a janela pode trocá-los
+// por um preset (ver DifficultyPreset.h), e as ferramentas de análise e ajuste (ecorunner-difficulty,
+// ecorunner-tune) os mudam antes de initGame para comparar variações do jogo.
+typedef struct {
+    float speedRamp;          // A velocidade dos obstáculos cresce gameTime * speedRamp a cada passo.
+    int minObstacleSpacing;   // Espaço mínimo entre um obstáculo e o próximo.
+    int randObstacleSpacing;  // Espaço extra sorteado (de 0 a randObstacleSpacing - 1).
+    int minTrashBinSpacing;   // O mesmo para as lixeiras.
+    int randTrashBinSpacing;
+} DifficultySettings_s;
+
+
+// Janela de previsão da rolagem usada pelo lixo arremessado (ver ThrownTrash.cpp).
+// Velocidade e deslocamento acumulado em cada passo a partir de 'base'; é só um cache,
+// refeito quando necessário. Zerada, é uma janela vazia.
+typedef struct {
+    long long base;           // Passo em que a janela começa (a posição 0 é o passo base + 1).
+    float* obstacleSpeedAt;   // [n] = deslocamento dos obstáculos no passo base + 1 + n.
+    float* binSpeedAt;        // [n] = deslocamento das lixeiras no mesmo passo.
+    double* obstacleShiftAt;  // [n] = soma dos deslocamentos dos obstáculos de base + 1 até base + 1 + n.
+    double* binShiftAt;       // [n] = o mesmo para as lixeiras.
+    int count, capacity;
+} ScrollForecastCache_s;
+
+
+// Acertos do lixo arremessado em um passo, na ordem do pool (ver checkAllCollisions). É só memória
+// de trabalho, reaproveitada de um passo para o outro. As remoções mudam os índices (swap-remove),
+// então os objetos atingidos são guardados como handles.
+typedef struct {
+    PoolHandle_s* items;      // Item que acertou algo.
+    PoolHandle_s* monsters;   // Monstro atingido (slot -1 se nenhum).
+    int* bins;                // Lixeira atingida (-1 se nenhuma). Lixeiras nunca são removidas.
+    int capacity;
+} ThrownTrashHits_s;
+
+
+// --- O MUNDO DO JOGO ---
+// Todo o estado de uma partida fica em um GameWorld_s, passado explicitamente para as funções
+// do núcleo (initGame, step, checkAllCollisions...) e do desenho. Nada disso é global: um mesmo
+// processo pode ter quantos mundos quiser, inclusive avançando em threads diferentes
+// (cada mundo só pode ser usado por uma thread de cada vez).
+// Um mundo novo deve passar por initWorld antes do primeiro uso, e por freeWorld no fim.
+typedef struct {
+    GameState gameState;                 // Armazena o estado atual do jogo (MENU, PLAYING, etc.).
+    Player_s player;                     // A struct com todos os dados do jogador.
+    Obstacles_s obstacles;               // Pool com os obstáculos do jogo.
+    TrashBins_s trashBins;               // Pool com as lixeiras.
+    TrashItems_s thrownTrashItems;       // Pool com os itens de lixo arremessados.
+    ScrollQueue_s obstacleQueue;         // Obstáculos em ordem de X, do mais à esquerda ao mais à direita.
+    ScrollQueue_s trashBinQueue;         // Lixeiras em ordem de X.
+    CollisionStats_s collisionStats;     // Contadores de pares testados/atingidos.
+    long long simTick;                   // Passos simulados desde o início da partida.
+    long long nextThrownTrashEvent;      // Menor passo previsto de evento de um lixo arremessado (ver ThrownTrash.h).
+    ScrollForecastCache_s forecast;      // Previsão da rolagem para o lixo arremessado.
+    ThrownTrashHits_s thrownTrashHits;   // Acertos do passo em andamento.
+    unsigned long long gameSeed;         // Semente do gerador aleatório (ver setGameSeed).
+    long long matchIndex;                // Partidas iniciadas desde a última semente, menos 1 (a atual).
+    SpawnCounters_s spawnCounters;       // Índices dos próximos sorteios da partida.
+    DifficultySettings_s difficulty;     // Aceleração e espaçamento dos obstáculos.
+    int score;                           // Pontuação atual do jogador.
+    int lives;                           // Vidas restantes do jogador.
+    int nextLifeScore;                   // Pontuação necessária para ganhar a próxima vida.
+    float currentObstacleSpeed;          // Velocidade atual dos obstáculos, que aumenta com o tempo.
+    float gameTime;                      // Contador de tempo de jogo.
+    float backgroundOffset1;             // Deslocamento do primeiro plano de fundo para efeito parallax.
+    float backgroundOffset2;             // Deslocamento do segundo plano de fundo para efeito parallax.
+    float prevBackgroundOffset1, prevBackgroundOffset2; // Deslocamentos do fundo no passo anterior.
+    float playerAnimationTimer;          // Timer para controlar a animação de corrida do jogador.
+    int currentPlayerRunFrame;           // Frame atual da animação de corrida (0 ou 1).
+    // Largura da área visível. A lógica usa a largura para decidir onde nascem e somem os objetos;
+    // na janela ela acompanha o reshape (ver setWorldViewWidth), no simulador fica com o tamanho padrão.
+    int viewWidth;
+    // Se 1, a lógica imprime no console os avisos da partida (vida extra...). Desligado nas simulações
+    // em massa (simulador, VecEnv, planejador), em que as mensagens seriam repetidas milhares de vezes.
+    int logMessages;
+    // Se 1, o lixo arremessado é testado a cada passo, sem a previsão de eventos: é a antiga simulação
+    // passo a passo, usada só para conferir a previsão (ecorunner-sim --check-events).
+    int thrownTrashEveryTick;
+} GameWorld_s;
+
+void initWorld(GameWorld_s* world);  // Deixa o mundo no estado inicial (MENU, tamanho padrão, semente 1).
+void freeWorld(GameWorld_s* world);  // Libera a memória dos pools, filas e da previsão.
+void setWorldViewWidth(GameWorld_s* world, int width); // Muda a largura visível (recalcula o lixo no ar).
+
+#endif // WORLD_H
@@ -4,17 +4,22 @@
 // --- Inclusão de Bibliotecas e Módulos ---
 // Inclui a biblioteca GLUT, essencial para criar janelas e gerenciar eventos.
 #include <GL/glut.h>
+#include <GL/freeglut.h> // Para glutInitContextVersion e glutInitContextProfile (pedir um contexto OpenGL 3.3).
 // Inclui bibliotecas padrão do C para entrada/saída e tempo.
 #include <stdio.h>
 #include <time.h>
+#include <stdlib.h>
+#include <string.h>
 
 // Inclui nossos próprios módulos, trazendo as declarações de funções e tipos de cada um.
 #include "Config.h"
 #include "Globals.h"
 #include "Texture.h"
 #include "GameLogic.h"
+#include "GameLoop.h"
 #include "Renderer.h"
 #include "Input.h"
+#include "DifficultyPreset.h"
 
 // Definição do STB_IMAGE_IMPLEMENTATION (APENAS EM UM ARQUIVO .CPP)
 // Esta linha diz à biblioteca stb_image.h para incluir aqui o código-fonte
@@ -42,9 +47,34 @@ int main(int argc, char** argv) {
         perror("Falha ao obter o diretorio de trabalho atual");
     }
 
+    // O mundo da janela começa no menu; a partida só é criada ao clicar em "Iniciar".
+    initWorld(&g_world);
+    // Se existir um preset de dificuldade (gerado por ecorunner-tune), ele substitui os espaçamentos padrão.
+    if (loadDifficultyPreset(DIFFICULTY_PRESET_FILE, &g_world.difficulty)) {
+        printf("Preset de dificuldade carregado de %s.\n", DIFFICULTY_PRESET_FILE);
+    }
+
     // --- INICIALIZAÇÃO DO GLUT E DA JANELA ---
     // Inicializa a biblioteca GLUT, passando os argumentos da linha de comando.
     glutInit(&argc, argv);
+    // Depois de glutInit, argv tem só as opções do jogo (o GLUT remove as suas).
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--sprite-stress") == 0 && i + 1 < argc) {
+            g_spriteStress = atoi(argv[++i]);
+            printf("Teste de carga: %d sprites extras por quadro.\n", g_spriteStress);
+        } else if (strcmp(argv[i], "--renderer") == 0 && i + 1 < argc) {
+            ++i;
+            if (strcmp(argv[i], "core") == 0) g_renderBackend = RENDER_BACKEND_CORE;
+            else if (strcmp(argv[i], "instanced") == 0) g_renderBackend = RENDER_BACKEND_INSTANCED;
+            else g_renderBackend = RENDER_BACKEND_LEGACY;
+        }
+    }
+    // O caminho OpenGL 3.3 precisa de um contexto 3.3. O perfil de compatibilidade mantém disponíveis
+    // as funções antigas que o menu, os botões e o texto do GLUT ainda usam.
+    if (g_renderBackend != RENDER_BACKEND_LEGACY) {
+        glutInitContextVersion(3, 3);
+        glutInitContextProfile(GLUT_COMPATIBILITY_PROFILE);
+    }
     // Configura o modo de exibição da janela.
     // GLUT_DOUBLE -> Usa um buffer duplo para evitar cintilação (flickering) nas animações.
     // GLUT_RGB    -> Define o modo de cor para Vermelho, Verde e Azul.
@@ -66,6 +96,8 @@ int main(int argc, char** argv) {
 
     // Chama nossa função para carregar todas as imagens do jogo para a memória da GPU.
     loadAllTextures();
+    // Prepara o caminho de desenho escolhido (pipeline fixo ou OpenGL 3.3).
+    initRenderer();
 
     // --- REGISTRO DE CALLBACKS ---
     // Esta é a parte central do GLUT. Dizemos ao GLUT qual de nossas funções chamar
@@ -78,13 +110,19 @@ int main(int argc, char** argv) {
     glutSpecialUpFunc(specialKeyboardUp); // Quando uma tecla especial for solta, chame 'specialKeyboardUp'.
     glutMouseFunc(mouse);               // Quando ocorrer um clique do mouse, chame 'mouse'.
     
-    // Configura o timer para o nosso loop de lógica do jogo.
-    // Diz ao GLUT para chamar a função 'updateGame' após 16 milissegundos (~60 FPS).
-    glutTimerFunc(16, updateGame, 0);
+    glutWindowStatusFunc(windowStatus); // Quando a janela for escondida ou voltar a aparecer, chame 'windowStatus'.
+
+    // Configura o loop de lógica do jogo.
+    // Durante a partida um timer do GLUT chama 'updateGame' ~60 vezes por segundo; ela mede o tempo
+    // real e avança a simulação em passos fixos (~60 por segundo), independente de atrasos do timer.
+    // Nas telas paradas (menu, pausa, fim de jogo) o timer não é reagendado e o programa só acorda
+    // com eventos (ver refreshGameLoop em GameLoop.cpp).
+    refreshGameLoop();
 
     // Inicializa o gerador de números aleatórios usando o tempo atual como semente.
-    // Isso garante que a sequência de obstáculos seja diferente a cada vez que o jogo é executado.
-    srand(time(NULL));
+    // Isso garante que a sequência de obstáculos seja diferente a cada vez que o jogo é executado
+    // (e cada partida seguinte tem a sua própria fase; ver Random.h).
+    setGameSeed(&g_world, (unsigned long long)time(NULL));
     
     printf("Iniciando loop principal do GLUT...\n");
     // Inicia o loop de eventos do GLUT. O programa fica "preso" aqui, esperando por
@@ -94,5 +132,7 @@ int main(int argc, char** argv) {
     // Esta parte do código só é alcançada quando o glutMainLoop termina (geralmente ao fechar a janela).
     // Libera a memória da GPU que foi alocada para as texturas.
     cleanupTextures();
+    cleanupRenderer();
+    freeWorld(&g_world);
     return 0;
 }
@@ -0,0 +1,206 @@
+// --- ecorunner-bench-entities ---
+// Compara o movimento dos objetos no formato antigo (array de structs com posições livres,
+// testando um 'if (active)' por posição) com o pool denso em estrutura de arrays (Pool.h)
+// e os kernels de SimdKernels.h (mais a integração dos projéteis, deste arquivo), em cada nível
+// de instrução disponível (escalar, SSE2, AVX), para 10, 1.000 e 100.000 posições (das quais
+// ~3/4 estão ocupadas).
+//
+// Uso: ecorunner-bench-entities
+#include "Config.h"
+#include "SimdKernels.h"
+#include "Pool.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+
+// As instruções SSE/AVX só existem em processadores x86 (mesmo teste de SimdKernels.cpp).
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #define ECO_SIMD_X86 1
+    #include <immintrin.h>
+#else
+    #define ECO_SIMD_X86 0
+#endif
+
+// Réplica do layout antigo (Globals.h antes da estrutura de arrays), usado como referência.
+typedef struct {
+    float x, y;
+    float width, height;
+    TrashType type;
+    int active;
+    float velocityX;
+    float velocityY;
+} LegacyEntity_s;
+
+// --- Integração dos Projéteis ---
+// x += vx; y += vy; vy -= gravity, o laço da antiga integração passo a passo do lixo arremessado.
+// O jogo passou a usar a trajetória em forma fechada (core/ThrownTrash.h), então o kernel só existe
+// aqui, como carga de referência do benchmark. Segue o modelo de SimdKernels.cpp: as versões SSE2
+// e AVX fazem as mesmas operações da escalar, na mesma ordem.
+
+static void integrateProjectilesScalar(float* x, float* y, const float* velocityX, float* velocityY,
+                                       int begin, int count, float gravity) {
+    for (int i = begin; i < count; i++) {
+        x[i] += velocityX[i];
+        y[i] += velocityY[i];
+        velocityY[i] -= gravity;
+    }
+}
+
+#if ECO_SIMD_X86
+__attribute__((target("sse2")))
+static void integrateProjectilesSse2(float* x, float* y, const float* velocityX, float* velocityY,
+                                     int count, float gravity) {
+    const __m128 g = _mm_set1_ps(gravity);
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 vy = _mm_loadu_ps(velocityY + i);
+        _mm_storeu_ps(x + i, _mm_add_ps(_mm_loadu_ps(x + i), _mm_loadu_ps(velocityX + i)));
+        _mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), vy));
+        _mm_storeu_ps(velocityY + i, _mm_sub_ps(vy, g));
+    }
+    integrateProjectilesScalar(x, y, velocityX, velocityY, i, count, gravity);
+}
+
+__attribute__((target("avx")))
+static void integrateProjectilesAvx(float* x, float* y, const float* velocityX, float* velocityY,
+                                    int count, float gravity) {
+    const __m256 g = _mm256_set1_ps(gravity);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 vy = _mm256_loadu_ps(velocityY + i);
+        _mm256_storeu_ps(x + i, _mm256_add_ps(_mm256_loadu_ps(x + i), _mm256_loadu_ps(velocityX + i)));
+        _mm256_storeu_ps(y + i, _mm256_add_ps(_mm256_loadu_ps(y + i), vy));
+        _mm256_storeu_ps(velocityY + i, _mm256_sub_ps(vy, g));
+    }
+    integrateProjectilesScalar(x, y, velocityX, velocityY, i, count, gravity);
+}
+#endif
+
+static void integrateProjectiles(float* x, float* y, const float* velocityX, float* velocityY,
+                                int count, float gravity) {
+    switch (getSimdLevel()) {
+#if ECO_SIMD_X86
+        case SIMD_AVX:  integrateProjectilesAvx(x, y, velocityX, velocityY, count, gravity); return;
+        case SIMD_SSE2: integrateProjectilesSse2(x, y, velocityX, velocityY, count, gravity); return;
+#endif
+        default:        integrateProjectilesScalar(x, y, velocityX, velocityY, 0, count, gravity); return;
+    }
+}
+
+static double secondsSince(std::chrono::steady_clock::time_point start) {
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+// Preenche os dois formatos com os mesmos objetos. Cerca de 3/4 das posições do formato antigo
+// ficam ativas, espalhadas de forma aleatória, para que o 'if (active)' não seja previsível;
+// o pool denso recebe apenas os objetos ativos, na mesma ordem.
+static void fillEntities(LegacyEntity_s* legacy, EntityPool_s<TrashType>* pool, int count) {
+    srand(1234);
+    poolClear(pool);
+    for (int i = 0; i < count; i++) {
+        legacy[i].x = (float)(rand() % 800);
+        legacy[i].y = (float)(rand() % 600);
+        legacy[i].width = legacy[i].height = 25.0f;
+        legacy[i].type = PAPER;
+        legacy[i].velocityX = TRASH_ITEM_SPEED_X;
+        legacy[i].velocityY = TRASH_ITEM_INITIAL_SPEED_Y;
+        legacy[i].active = (rand() % 4) != 0;
+        if (legacy[i].active) {
+            int k = poolSpawn(pool);
+            pool->x[k] = legacy[i].x;
+            pool->y[k] = legacy[i].y;
+            pool->velocityX[k] = legacy[i].velocityX;
+            pool->velocityY[k] = legacy[i].velocityY;
+        }
+    }
+}
+
+// Soma as posições para que o compilador não descarte o trabalho medido.
+static double checksum(const float* x, const float* y, int count) {
+    double sum = 0.0;
+    for (int i = 0; i < count; i++) sum += x[i] + y[i];
+    return sum;
+}
+
+static void benchmark(int count) {
+    // Repetições suficientes para ~20 milhões de atualizações por medição.
+    int repetitions = 20000000 / count;
+    if (repetitions < 1) repetitions = 1;
+    const float gravity = GRAVITY * 0.35f;
+
+    LegacyEntity_s* legacy = (LegacyEntity_s*)malloc(sizeof(LegacyEntity_s) * count);
+    EntityPool_s<TrashType> pool = {};
+
+    // 1. Referência: array de structs com desvio por objeto, como o laço original do updateGame.
+    fillEntities(legacy, &pool, count);
+    printf("\n--- %d posicoes, %d objetos vivos (%d repeticoes) ---\n", count, pool.count, repetitions);
+    printf("%-22s %14s %14s %10s\n", "variante", "rolagem ns/obj", "projetil ns/obj", "ganho");
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repetitions; r++) {
+        for (int i = 0; i < count; i++) {
+            if (legacy[i].active) legacy[i].x -= OBSTACLE_SPEED_BASE;
+        }
+    }
+    double legacyScroll = secondsSince(start);
+    start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repetitions; r++) {
+        for (int i = 0; i < count; i++) {
+            if (legacy[i].active) {
+                legacy[i].x += legacy[i].velocityX;
+                legacy[i].y += legacy[i].velocityY;
+                legacy[i].velocityY -= gravity;
+            }
+        }
+    }
+    double legacyProjectile = secondsSince(start);
+    double legacySum = 0.0;
+    for (int i = 0; i < count; i++) {
+        if (legacy[i].active) legacySum += legacy[i].x + legacy[i].y;
+    }
+
+    // Os tempos são divididos pelo número de objetos vivos, que é o trabalho útil.
+    double updates = (double)pool.count * repetitions;
+    printf("%-22s %14.3f %14.3f %10s\n", "AoS + if (original)",
+           legacyScroll * 1e9 / updates, legacyProjectile * 1e9 / updates, "1.00x");
+
+    // 2. Pool denso em estrutura de arrays, em cada nível SIMD suportado pela CPU.
+    SimdLevel best = detectSimdLevel();
+    for (int level = SIMD_SCALAR; level <= best; level++) {
+        setSimdLevel((SimdLevel)level);
+        fillEntities(legacy, &pool, count);
+
+        start = std::chrono::steady_clock::now();
+        for (int r = 0; r < repetitions; r++) {
+            scrollEntities(pool.x, pool.count, OBSTACLE_SPEED_BASE);
+        }
+        double scroll = secondsSince(start);
+        start = std::chrono::steady_clock::now();
+        for (int r = 0; r < repetitions; r++) {
+            integrateProjectiles(pool.x, pool.y, pool.velocityX, pool.velocityY, pool.count, gravity);
+        }
+        double projectile = secondsSince(start);
+
+        // Os kernels devem produzir exatamente o mesmo resultado do laço original.
+        double sum = checksum(pool.x, pool.y, pool.count);
+        char label[40], gain[16];
+        snprintf(label, sizeof(label), "pool SoA %s", simdLevelName((SimdLevel)level));
+        snprintf(gain, sizeof(gain), "%.2fx", (legacyScroll + legacyProjectile) / (scroll + projectile));
+        printf("%-22s %14.3f %14.3f %10s%s\n", label, scroll * 1e9 / updates, projectile * 1e9 / updates, gain,
+               sum == legacySum ? "" : "  (RESULTADO DIFERENTE!)");
+    }
+    setSimdLevel(best);
+
+    free(legacy);
+    poolFree(&pool);
+}
+
+int main() {
+    printf("Benchmark de movimento de objetos: AoS vs pool SoA + SIMD (melhor nivel: %s)\n", simdLevelName(detectSimdLevel()));
+    const int sizes[] = {10, 1000, 100000};
+    for (int i = 0; i < 3; i++) {
+        benchmark(sizes[i]);
+    }
+    return 0;
+}
@@ -0,0 +1,85 @@
+// --- ecorunner-bench-vecenv ---
+// Mede quantos passos de ambiente por segundo a API de ambientes vetorizados (core/VecEnv.h)
+// consegue executar: K mundos avançando juntos, cada um com uma ação aleatória por passo
+// (como um agente que ainda não aprendeu nada), lendo as observações, recompensas e fins de partida.
+//
+// Uso: ecorunner-bench-vecenv [--envs K] [--steps N] [--seed S] [--threads T]
+#include "Config.h"
+#include "VecEnv.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+
+/**
+ * Gerador simples (xorshift) só para sortear as ações do benchmark.
+ */
+static unsigned int nextRandom(unsigned int* state) {
+    unsigned int x = *state;
+    x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+int main(int argc, char** argv) {
+    int envCount = 1024;
+    long long steps = 10000;
+    unsigned long long seed = 1;
+    int threads = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--envs") == 0 && i + 1 < argc) {
+            envCount = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--steps") == 0 && i + 1 < argc) {
+            steps = atoll(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+        } else {
+            fprintf(stderr, "Uso: %s [--envs K] [--steps N] [--seed S] [--threads T]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (envCount < 1) envCount = 1;
+
+    VecEnv_s* env = vecEnvCreate(envCount, seed, threads);
+    unsigned char* actions = (unsigned char*)malloc((size_t)envCount);
+    unsigned int randomState = 2463534242u;
+
+    printf("ecorunner-bench-vecenv: %d ambiente(s) x %lld passos, semente %llu, %d thread(s)\n",
+           envCount, steps, seed, threadPoolSize(env->pool));
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    // Ações aleatórias: pulo e agachar frequentes, arremesso e troca de lixo mais raros.
+    double rewardSum = 0.0;
+    long long dones = 0;
+    for (long long s = 0; s < steps; s++) {
+        for (int k = 0; k < envCount; k++) {
+            unsigned int r = nextRandom(&randomState);
+            unsigned char action = 0;
+            if ((r & 15) == 0) action |= VEC_ENV_JUMP;
+            if (((r >> 4) & 3) == 0) action |= VEC_ENV_DUCK;
+            if (((r >> 6) & 31) == 0) action |= VEC_ENV_THROW;
+            if (((r >> 11) & 63) == 0) action |= VEC_ENV_CYCLE_TRASH;
+            actions[k] = action;
+        }
+        vecEnvStep(env, actions);
+        for (int k = 0; k < envCount; k++) {
+            rewardSum += env->rewards[k];
+            dones += env->dones[k];
+        }
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    double seconds = elapsed.count();
+    double totalSteps = (double)steps * envCount;
+
+    printf("Partidas encerradas: %lld (recompensa total: %.0f)\n", dones, rewardSum);
+    printf("Tempo: %.3f s\n", seconds);
+    printf("Passos de ambiente por segundo: %.0f\n", seconds > 0.0 ? totalSteps / seconds : 0.0);
+
+    free(actions);
+    vecEnvDestroy(env);
+    return 0;
+}
@@ -0,0 +1,313 @@
+// --- ecorunner-difficulty ---
+// Analisador de dificuldade por Monte Carlo: joga muitas partidas com sementes fixas, com o
+// jogador automático (core/AutoPlayer.h), para cada combinação de parâmetros de dificuldade
+// (aceleração dos obstáculos, espaçamento entre eles e entre as lixeiras), em todas as threads da máquina.
+// Escreve em CSV a distribuição do tempo de sobrevivência, da pontuação e das vidas perdidas.
+// Como em ecorunner-tune, o bot joga com distrações (AutoPlayerLapses_s); sem elas ele quase nunca
+// perde vidas e as distribuições quase não mudam com os parâmetros.
+//
+// Uso: ecorunner-difficulty [--ramps L] [--min-spacings L] [--rand-spacings L] [--min-bin-spacings L]
+//                           [--rand-bin-spacings L] [--games N] [--max-ticks T] [--lapse-rate R]
+//                           [--lapse-seconds D] [--seed S] [--threads T] [--out arquivo.csv] [--games-csv arquivo.csv]
+//   L é uma lista separada por vírgulas (ex.: --min-spacings 350,450,550). Parâmetros sem lista
+//   ficam com o valor padrão do mundo (initWorld). Como no preset, os espaçamentos são inteiros,
+//   os mínimos não podem ser menores que MIN_PLAYABLE_SPACING e rampas e sorteios não são negativos.
+//   --games:     partidas por combinação. A partida g usa a semente S + g em todas as combinações,
+//                então as combinações são comparadas com as mesmas sequências de obstáculos.
+//   --max-ticks: limite de cada partida (a partida que chega nele conta como sobrevivente).
+//   --lapse-rate, --lapse-seconds: distrações do bot (padrão 0.5 por segundo, 1 s cada; 0 desliga).
+//   --out:       resumo por combinação (padrão: difficulty.csv).
+//   --games-csv: opcional, uma linha por partida.
+#include "Config.h"
+#include "World.h"
+#include "GameLogic.h"
+#include "AutoPlayer.h"
+#include "SimdKernels.h"
+#include "ThreadPool.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+
+#define MAX_SWEEP_VALUES 32 // Valores por lista de parâmetros.
+#define MAX_SPACING 100000  // Maior espaçamento aceito (o mesmo limite do preset).
+
+// Resultado de uma partida.
+typedef struct {
+    long long survivalTicks; // Passos até o fim da partida (ou até --max-ticks).
+    int score;
+    int livesLost;           // Vidas perdidas em colisões (vidas extras ganhas não descontam).
+    int died;                // 1 se a partida acabou em GAME_OVER antes do limite.
+    float finalSpeed;        // Velocidade dos obstáculos no fim.
+} GameResult_s;
+
+typedef struct {
+    DifficultySettings_s* settings; // [combinações]
+    int gamesPerSetting;
+    long long maxTicks;
+    unsigned long long seed;
+    double lapseRate;               // Distrações do bot (ver AutoPlayerLapses_s).
+    double lapseSeconds;
+    GameResult_s* results;          // [combinação * gamesPerSetting + partida]
+} Sweep_s;
+
+/**
+ * Joga a partida 'index' (combinação index / gamesPerSetting). Executada pelas threads do pool:
+ * cada chamada usa o seu próprio mundo e escreve só o seu resultado.
+ */
+static void playGame(void* context, int index) {
+    Sweep_s* sweep = (Sweep_s*)context;
+    int setting = index / sweep->gamesPerSetting, game = index % sweep->gamesPerSetting;
+    GameResult_s* result = &sweep->results[index];
+
+    GameWorld_s world;
+    initWorld(&world);
+    world.logMessages = 0;
+    world.difficulty = sweep->settings[setting];
+    setGameSeed(&world, sweep->seed + (unsigned long long)game);
+    initGame(&world);
+
+    // As distrações também só dependem da semente da partida.
+    AutoPlayerLapses_s lapses;
+    autoPlayerLapsesInit(&lapses, sweep->lapseRate, sweep->lapseSeconds, sweep->seed + (unsigned long long)game);
+
+    memset(result, 0, sizeof(*result));
+    while (world.gameState == PLAYING && world.simTick < sweep->maxTicks) {
+        int lives = world.lives;
+        autoPlayerActWithLapses(&world, &lapses);
+        step(&world);
+        if (world.lives < lives) result->livesLost += lives - world.lives;
+    }
+    result->survivalTicks = world.simTick;
+    result->score = world.score;
+    result->died = world.gameState == GAME_OVER;
+    result->finalSpeed = world.currentObstacleSpeed;
+    freeWorld(&world);
+}
+
+/**
+ * Lê uma lista de números separados por vírgula, cada um em [minimum, maximum] (e inteiro, se
+ * 'integers'). Devolve quantos foram lidos, ou -1 se algum não for válido: como no preset
+ * (ver DifficultyPreset.cpp), valores que deixariam o jogo impossível não são simulados.
+ */
+static int parseList(const char* text, double* values, double minimum, double maximum, int integers) {
+    int count = 0;
+    while (*text && count < MAX_SWEEP_VALUES) {
+        char* end;
+        double value = strtod(text, &end);
+        if (end == text || (*end != ',' && *end != '\0')) return -1;
+        if (value < minimum || value > maximum || (integers && value != (double)(long)value)) return -1;
+        values[count++] = value;
+        text = (*end == ',') ? end + 1 : end;
+    }
+    return count;
+}
+
+// Lê a lista da opção 'option'; avisa e devolve -1 se ela for inválida.
+static int parseOption(const char* option, const char* text, double* values, double minimum, double maximum, int integers) {
+    int count = parseList(text, values, minimum, maximum, integers);
+    if (count < 0) {
+        fprintf(stderr, "%s: valores invalidos em '%s' (aceitos: %s de %g a %g).\n", option, text,
+                integers ? "inteiros" : "numeros", minimum, maximum);
+    }
+    return count;
+}
+
+static int compareDoubles(const void* a, const void* b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * Quantil 'q' (0 a 1) de valores já ordenados, pelo vizinho mais próximo.
+ */
+static double quantile(const double* sorted, int count, double q) {
+    int i = (int)(q * (count - 1) + 0.5);
+    return sorted[i];
+}
+
+static double mean(const double* values, int count) {
+    double sum = 0.0;
+    for (int i = 0; i < count; i++) sum += values[i];
+    return sum / count;
+}
+
+// Escreve média e quantis (10%, 50%, 90%) de uma coluna; ordena os valores.
+static void writeDistribution(FILE* out, double* values, int count) {
+    qsort(values, (size_t)count, sizeof(double), compareDoubles);
+    fprintf(out, ",%.3f,%.3f,%.3f,%.3f", mean(values, count),
+            quantile(values, count, 0.10), quantile(values, count, 0.50), quantile(values, count, 0.90));
+}
+
+int main(int argc, char** argv) {
+    double ramps[MAX_SWEEP_VALUES] = {OBSTACLE_SPEED_RAMP};
+    double minSpacings[MAX_SWEEP_VALUES] = {MIN_OBSTACLE_SPACING};
+    double randSpacings[MAX_SWEEP_VALUES] = {RAND_OBSTACLE_SPACING};
+    double minBinSpacings[MAX_SWEEP_VALUES] = {MIN_TRASHBIN_SPACING};
+    double randBinSpacings[MAX_SWEEP_VALUES] = {RAND_TRASHBIN_SPACING};
+    int rampCount = 1, minCount = 1, randCount = 1, minBinCount = 1, randBinCount = 1;
+    int games = 200;
+    long long maxTicks = 36000; // 10 minutos de jogo.
+    double lapseRate = AUTOPLAYER_LAPSE_RATE, lapseSeconds = AUTOPLAYER_LAPSE_SECONDS;
+    unsigned long long seed = 1;
+    int threads = 0;
+    const char* outPath = "difficulty.csv";
+    const char* gamesPath = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--ramps") == 0 && i + 1 < argc) {
+            rampCount = parseOption(argv[i], argv[i + 1], ramps, 0.0, 1.0, 0); i++;
+        } else if (strcmp(argv[i], "--min-spacings") == 0 && i + 1 < argc) {
+            minCount = parseOption(argv[i], argv[i + 1], minSpacings, MIN_PLAYABLE_SPACING, MAX_SPACING, 1); i++;
+        } else if (strcmp(argv[i], "--rand-spacings") == 0 && i + 1 < argc) {
+            randCount = parseOption(argv[i], argv[i + 1], randSpacings, 0, MAX_SPACING, 1); i++;
+        } else if (strcmp(argv[i], "--min-bin-spacings") == 0 && i + 1 < argc) {
+            minBinCount = parseOption(argv[i], argv[i + 1], minBinSpacings, MIN_PLAYABLE_SPACING, MAX_SPACING, 1); i++;
+        } else if (strcmp(argv[i], "--rand-bin-spacings") == 0 && i + 1 < argc) {
+            randBinCount = parseOption(argv[i], argv[i + 1], randBinSpacings, 0, MAX_SPACING, 1); i++;
+        } else if (strcmp(argv[i], "--games") == 0 && i + 1 < argc) {
+            games = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--max-ticks") == 0 && i + 1 < argc) {
+            maxTicks = atoll(argv[++i]);
+        } else if (strcmp(argv[i], "--lapse-rate") == 0 && i + 1 < argc) {
+            lapseRate = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--lapse-seconds") == 0 && i + 1 < argc) {
+            lapseSeconds = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+            outPath = argv[++i];
+        } else if (strcmp(argv[i], "--games-csv") == 0 && i + 1 < argc) {
+            gamesPath = argv[++i];
+        } else {
+            fprintf(stderr, "Uso: %s [--ramps L] [--min-spacings L] [--rand-spacings L] [--min-bin-spacings L]\n"
+                            "          [--rand-bin-spacings L] [--games N] [--max-ticks T] [--lapse-rate R]\n"
+                            "          [--lapse-seconds D] [--seed S] [--threads T] [--out arquivo.csv] [--games-csv arquivo.csv]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (rampCount < 0 || minCount < 0 || randCount < 0 || minBinCount < 0 || randBinCount < 0) return 1;
+    if (rampCount < 1 || minCount < 1 || randCount < 1 || minBinCount < 1 || randBinCount < 1 || games < 1) {
+        fprintf(stderr, "Listas de parametros e numero de partidas nao podem ser vazios.\n");
+        return 1;
+    }
+
+    // Todas as combinações dos valores pedidos. Cada combinação parte dos parâmetros padrão do
+    // mundo, para que campos sem opção aqui também tenham valores definidos.
+    GameWorld_s defaultWorld;
+    initWorld(&defaultWorld);
+    DifficultySettings_s defaults = defaultWorld.difficulty;
+    freeWorld(&defaultWorld);
+    int settingCount = rampCount * minCount * randCount * minBinCount * randBinCount;
+    DifficultySettings_s* settings = (DifficultySettings_s*)malloc(sizeof(DifficultySettings_s) * (size_t)settingCount);
+    int s = 0;
+    for (int r = 0; r < rampCount; r++) {
+        for (int m = 0; m < minCount; m++) {
+            for (int d = 0; d < randCount; d++) {
+                for (int bm = 0; bm < minBinCount; bm++) {
+                    for (int bd = 0; bd < randBinCount; bd++, s++) {
+                        settings[s] = defaults;
+                        settings[s].speedRamp = (float)ramps[r];
+                        settings[s].minObstacleSpacing = (int)minSpacings[m];
+                        settings[s].randObstacleSpacing = (int)randSpacings[d];
+                        settings[s].minTrashBinSpacing = (int)minBinSpacings[bm];
+                        settings[s].randTrashBinSpacing = (int)randBinSpacings[bd];
+                    }
+                }
+            }
+        }
+    }
+
+    Sweep_s sweep;
+    sweep.settings = settings;
+    sweep.gamesPerSetting = games;
+    sweep.maxTicks = maxTicks;
+    sweep.seed = seed;
+    sweep.lapseRate = lapseRate;
+    sweep.lapseSeconds = lapseSeconds;
+    sweep.results = (GameResult_s*)malloc(sizeof(GameResult_s) * (size_t)settingCount * games);
+
+    // Os mundos não compartilham estado; só o nível SIMD é global, então é escolhido antes das threads.
+    getSimdLevel();
+    ThreadPool_s* pool = threadPoolCreate(threads);
+    printf("ecorunner-difficulty: %d combinacao(oes) x %d partidas (ate %lld passos), %d thread(s), %.2f distracoes/s de %.2f s\n",
+           settingCount, games, maxTicks, threadPoolSize(pool), lapseRate, lapseSeconds);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    // Uma tarefa por partida: as partidas têm durações muito diferentes, e tarefas pequenas
+    // mantêm todas as threads ocupadas até o fim.
+    threadPoolRun(pool, settingCount * games, playGame, &sweep);
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    long long totalTicks = 0;
+    for (int i = 0; i < settingCount * games; i++) totalTicks += sweep.results[i].survivalTicks;
+    printf("Tempo: %.3f s (%.0f passos por segundo)\n", elapsed.count(), elapsed.count() > 0.0 ? totalTicks / elapsed.count() : 0.0);
+
+    // --- Resumo por combinação ---
+    FILE* out = fopen(outPath, "w");
+    if (!out) {
+        fprintf(stderr, "Nao foi possivel criar %s\n", outPath);
+        return 1;
+    }
+    fprintf(out, "speed_ramp,min_obstacle_spacing,rand_obstacle_spacing,min_trash_bin_spacing,rand_trash_bin_spacing,"
+                 "games,death_rate,"
+                 "survival_s_mean,survival_s_p10,survival_s_p50,survival_s_p90,"
+                 "score_mean,score_p10,score_p50,score_p90,"
+                 "lives_lost_mean,lives_lost_p10,lives_lost_p50,lives_lost_p90,final_speed_mean\n");
+    double* column = (double*)malloc(sizeof(double) * (size_t)games);
+    for (s = 0; s < settingCount; s++) {
+        const GameResult_s* results = &sweep.results[(size_t)s * games];
+        int deaths = 0;
+        double speedSum = 0.0;
+        for (int g = 0; g < games; g++) {
+            deaths += results[g].died;
+            speedSum += results[g].finalSpeed;
+        }
+        fprintf(out, "%g,%d,%d,%d,%d,%d,%.4f", settings[s].speedRamp, settings[s].minObstacleSpacing,
+                settings[s].randObstacleSpacing, settings[s].minTrashBinSpacing, settings[s].randTrashBinSpacing,
+                games, (double)deaths / games);
+        for (int g = 0; g < games; g++) column[g] = results[g].survivalTicks * SIM_TICK_SECONDS;
+        writeDistribution(out, column, games);
+        for (int g = 0; g < games; g++) column[g] = results[g].score;
+        writeDistribution(out, column, games);
+        for (int g = 0; g < games; g++) column[g] = results[g].livesLost;
+        writeDistribution(out, column, games);
+        fprintf(out, ",%.3f\n", speedSum / games);
+
+        printf("rampa %g, espacamento %d+%d, lixeiras %d+%d: %.0f%% das partidas perdidas\n", settings[s].speedRamp,
+               settings[s].minObstacleSpacing, settings[s].randObstacleSpacing, settings[s].minTrashBinSpacing,
+               settings[s].randTrashBinSpacing, 100.0 * deaths / games);
+    }
+    fclose(out);
+    printf("Resumo gravado em %s\n", outPath);
+
+    // --- Uma linha por partida (opcional) ---
+    if (gamesPath) {
+        FILE* gamesOut = fopen(gamesPath, "w");
+        if (!gamesOut) {
+            fprintf(stderr, "Nao foi possivel criar %s\n", gamesPath);
+            return 1;
+        }
+        fprintf(gamesOut, "speed_ramp,min_obstacle_spacing,rand_obstacle_spacing,min_trash_bin_spacing,rand_trash_bin_spacing,"
+                          "seed,survival_s,score,lives_lost,died,final_speed\n");
+        for (s = 0; s < settingCount; s++) {
+            for (int g = 0; g < games; g++) {
+                const GameResult_s* r = &sweep.results[(size_t)s * games + g];
+                fprintf(gamesOut, "%g,%d,%d,%d,%d,%llu,%.3f,%d,%d,%d,%.3f\n", settings[s].speedRamp, settings[s].minObstacleSpacing,
+                        settings[s].randObstacleSpacing, settings[s].minTrashBinSpacing, settings[s].randTrashBinSpacing,
+                        seed + (unsigned long long)g, r->survivalTicks * SIM_TICK_SECONDS,
+                        r->score, r->livesLost, r->died, r->finalSpeed);
+            }
+        }
+        fclose(gamesOut);
+        printf("Partidas gravadas em %s\n", gamesPath);
+    }
+
+    free(column);
+    free(sweep.results);
+    free(settings);
+    threadPoolDestroy(pool);
+    return 0;
+}
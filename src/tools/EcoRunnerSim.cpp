@@ -0,0 +1,388 @@
+// --- ecorunner-sim ---
+// Simulador sem janela: roda a lógica do jogo (core/) por N passos, tão rápido quanto a CPU permitir,
+// e informa quantos passos por segundo foram executados. Usado em testes de resistência (soak)
+// e benchmarks em máquinas Linux sem tela.
+//
+// Uso: ecorunner-sim [--ticks N] [--seed S] [--skip] [--bot] [--planner] [--budget-ms B] [--worlds W] [--threads T]
+//                     [--check-events] [--check-skip]
+//   --skip:    pula os trechos sem eventos (ver skipTicks em GameLogic.cpp). O resultado é idêntico
+//              ao de avançar passo a passo, só mais rápido; útil para curvas de sobrevivência.
+//   --bot:     o jogador automático (core/AutoPlayer.h) joga, e as partidas duram horas de jogo.
+//              Como o bot age a cada passo, ignora --skip.
+//   --planner: o planejador por busca em feixe (core/Planner.h) joga, com até B milissegundos
+//              por passo (--budget-ms, padrão 2). Informa os estados simulados por segundo.
+//   --worlds:  quantos mundos independentes simular (cada um com N passos). O mundo w usa a
+//              semente S + w, então o resultado não depende do número de threads.
+//   --threads: threads do pool que avança os mundos (0 = uma por núcleo).
+//   --check-events: confere a previsão de eventos do lixo arremessado (ver ThrownTrash.h). Dois mundos
+//              com a mesma semente jogam lado a lado, arremessando um lixo a cada 3 passos (trocando
+//              o tipo a cada arremesso); um testa o lixo a cada passo, o outro só nos eventos
+//              previstos. Informa o primeiro passo em que eles divergem, se houver. Cada partida
+//              dura no máximo CHECK_MATCH_TICKS passos, e as partidas alternam a aceleração dos
+//              obstáculos (o mesmo mundo é reaproveitado com outra dificuldade).
+//   --check-skip: confere o salto de passos sem eventos (--skip). Dois mundos com a mesma semente
+//              recebem as mesmas entradas (pulo, agachar/levantar, arremesso) a intervalos
+//              sorteados de 1 a CHECK_SKIP_MAX_GAP passos; entre elas um avança passo a passo e o
+//              outro com skipTicks. Informa o primeiro trecho em que os estados diferem (bit a bit).
+#include "Config.h"
+#include "World.h"
+#include "GameLogic.h"
+#include "Player.h"
+#include "AutoPlayer.h"
+#include "Planner.h"
+#include "SimdKernels.h"
+#include "ThreadPool.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+
+// Configuração comum a todos os mundos.
+typedef struct {
+    long long ticks;
+    unsigned int seed;
+    int skip;
+    int bot;
+    int planner;
+    double budgetSeconds; // Tempo do planejador por passo.
+} SimConfig_s;
+
+// Um mundo e as estatísticas da sua execução.
+typedef struct {
+    GameWorld_s world;
+    long long gamesFinished;
+    int bestScore;
+    float topSpeed;       // Maior velocidade dos obstáculos alcançada.
+    Planner_s* planner;   // Planejador do mundo (com --planner).
+} SimRun_s;
+
+typedef struct {
+    const SimConfig_s* config;
+    SimRun_s* runs;
+} SimBatch_s;
+
+/**
+ * Avança o mundo 'index' por todos os passos pedidos. Executada pelas threads do pool:
+ * cada chamada só toca o seu próprio mundo.
+ */
+static void runWorld(void* context, int index) {
+    SimBatch_s* batch = (SimBatch_s*)context;
+    const SimConfig_s* config = batch->config;
+    SimRun_s* run = &batch->runs[index];
+    GameWorld_s* world = &run->world;
+
+    // A semente fixa torna a execução reproduzível (a janela usa time(NULL)).
+    initWorld(world);
+    world->logMessages = 0;
+    setGameSeed(world, (unsigned long long)config->seed + (unsigned long long)index);
+    initGame(world);
+
+    if (config->planner) run->planner = plannerCreate(16, 30, 6, config->budgetSeconds);
+
+    for (long long t = 0; t < config->ticks; ) {
+        // Sem entrada do jogador, o modo --skip pode avançar vários passos por chamada.
+        if (config->planner) {
+            plannerAct(run->planner, world);
+            step(world);
+            t++;
+        } else if (config->bot) {
+            autoPlayerAct(world);
+            step(world);
+            t++;
+        } else if (config->skip) {
+            t += skipTicks(world, config->ticks - t);
+        } else {
+            step(world);
+            t++;
+        }
+        // Sem ninguém jogando a partida acaba rápido; reiniciamos para manter a carga constante.
+        if (world->currentObstacleSpeed > run->topSpeed) run->topSpeed = world->currentObstacleSpeed;
+        if (world->gameState == GAME_OVER) {
+            run->gamesFinished++;
+            if (world->score > run->bestScore) run->bestScore = world->score;
+            initGame(world);
+        }
+    }
+    // A partida em andamento no fim também conta (com o bot, ela pode durar a execução inteira).
+    if (world->score > run->bestScore) run->bestScore = world->score;
+}
+
+// Arremessos da conferência: um a cada CHECK_THROW_INTERVAL passos.
+#define CHECK_THROW_INTERVAL 3
+// Passos de cada partida da conferência (o bot que só desvia quase nunca perde).
+#define CHECK_MATCH_TICKS 3000
+
+/**
+ * Joga o mesmo jogo em um mundo que testa o lixo a cada passo e em outro que usa os eventos
+ * previstos, e compara os dois depois de cada passo. Devolve 0 se forem idênticos do início ao fim.
+ */
+static int checkThrownTrashEvents(const SimConfig_s* config) {
+    GameWorld_s worlds[2];
+    for (int w = 0; w < 2; w++) {
+        initWorld(&worlds[w]);
+        worlds[w].logMessages = 0;
+        worlds[w].thrownTrashEveryTick = (w == 0);
+        setGameSeed(&worlds[w], config->seed);
+        initGame(&worlds[w]);
+    }
+    GameWorld_s* perTick = &worlds[0];
+    GameWorld_s* events = &worlds[1];
+
+    long long throws = 0, gamesFinished = 0, matches = 0, divergedAt = -1;
+    for (long long t = 0; t < config->ticks && divergedAt < 0; t++) {
+        for (int w = 0; w < 2; w++) {
+            // O bot só desvia; os arremessos são bem mais frequentes que os dele.
+            autoPlayerDodge(&worlds[w]);
+            if (t % CHECK_THROW_INTERVAL == 0) {
+                cycleSelectedTrash(&worlds[w]);
+                spawnThrownTrashItem(&worlds[w]);
+            }
+            step(&worlds[w]);
+        }
+        if (t % CHECK_THROW_INTERVAL == 0) throws++;
+        if (perTick->score != events->score || perTick->lives != events->lives || perTick->gameState != events->gameState ||
+            perTick->thrownTrashItems.count != events->thrownTrashItems.count || perTick->obstacles.count != events->obstacles.count) {
+            divergedAt = t;
+            break;
+        }
+        if (perTick->gameState == GAME_OVER || perTick->simTick >= CHECK_MATCH_TICKS) {
+            if (perTick->gameState == GAME_OVER) gamesFinished++;
+            // A próxima partida usa outra aceleração, trocada antes de initGame.
+            matches++;
+            for (int w = 0; w < 2; w++) {
+                worlds[w].difficulty.speedRamp = OBSTACLE_SPEED_RAMP * (matches % 2 ? 4.0f : 1.0f);
+                initGame(&worlds[w]);
+            }
+        }
+    }
+
+    if (divergedAt >= 0) {
+        printf("Eventos do lixo DIVERGEM no passo %lld da execucao (passo %lld da partida)\n", divergedAt, events->simTick);
+        printf("  a cada passo: pontuacao %d, vidas %d, %d itens no ar, %d obstaculos\n",
+               perTick->score, perTick->lives, perTick->thrownTrashItems.count, perTick->obstacles.count);
+        printf("  por eventos:  pontuacao %d, vidas %d, %d itens no ar, %d obstaculos\n",
+               events->score, events->lives, events->thrownTrashItems.count, events->obstacles.count);
+    } else {
+        printf("Eventos do lixo conferidos: %lld passos, %lld arremessos, %lld partidas (%lld perdidas), identicos\n",
+               config->ticks, throws, matches + 1, gamesFinished);
+    }
+    freeWorld(perTick);
+    freeWorld(events);
+    return divergedAt >= 0 ? 1 : 0;
+}
+
+// Maior intervalo, em passos, entre duas entradas da conferência do salto.
+#define CHECK_SKIP_MAX_GAP 1000
+
+// Número pseudoaleatório de 64 bits que só depende da semente e de 'n' (splitmix64).
+static unsigned long long checkDraw(unsigned long long seed, long long n) {
+    unsigned long long v = seed * 0x9E3779B97F4A7C15ull + (unsigned long long)n;
+    v = (v ^ (v >> 30)) * 0xBF58476D1CE4E5B9ull;
+    v = (v ^ (v >> 27)) * 0x94D049BB133111EBull;
+    return v ^ (v >> 31);
+}
+
+// Compara as colunas de dois pools bit a bit.
+template <typename TypeEnum>
+static int poolsMatch(const EntityPool_s<TypeEnum>* a, const EntityPool_s<TypeEnum>* b) {
+    size_t bytes = sizeof(float) * (size_t)a->count;
+    return a->count == b->count &&
+           memcmp(a->x, b->x, bytes) == 0 && memcmp(a->y, b->y, bytes) == 0 &&
+           memcmp(a->prevX, b->prevX, bytes) == 0 && memcmp(a->prevY, b->prevY, bytes) == 0 &&
+           memcmp(a->type, b->type, sizeof(TypeEnum) * (size_t)a->count) == 0;
+}
+
+// Se os dois mundos estão no mesmo estado (tudo o que a simulação e o desenho usam).
+static int worldsMatch(const GameWorld_s* a, const GameWorld_s* b) {
+    return a->gameState == b->gameState && a->simTick == b->simTick &&
+           a->score == b->score && a->lives == b->lives && a->nextLifeScore == b->nextLifeScore &&
+           memcmp(&a->player, &b->player, sizeof(a->player)) == 0 &&
+           memcmp(&a->currentObstacleSpeed, &b->currentObstacleSpeed, sizeof(float)) == 0 &&
+           memcmp(&a->gameTime, &b->gameTime, sizeof(float)) == 0 &&
+           memcmp(&a->backgroundOffset1, &b->backgroundOffset1, sizeof(float)) == 0 &&
+           memcmp(&a->backgroundOffset2, &b->backgroundOffset2, sizeof(float)) == 0 &&
+           memcmp(&a->playerAnimationTimer, &b->playerAnimationTimer, sizeof(float)) == 0 &&
+           a->currentPlayerRunFrame == b->currentPlayerRunFrame &&
+           a->nextThrownTrashEvent == b->nextThrownTrashEvent &&
+           poolsMatch(&a->obstacles, &b->obstacles) && poolsMatch(&a->trashBins, &b->trashBins) &&
+           poolsMatch(&a->thrownTrashItems, &b->thrownTrashItems);
+}
+
+/**
+ * Joga o mesmo jogo roteirizado em um mundo que avança passo a passo e em outro que usa
+ * skipTicks entre as entradas, e compara os dois depois de cada trecho. Devolve 0 se forem
+ * idênticos do início ao fim.
+ */
+static int checkSkipTicks(const SimConfig_s* config) {
+    GameWorld_s worlds[2];
+    for (int w = 0; w < 2; w++) {
+        initWorld(&worlds[w]);
+        worlds[w].logMessages = 0;
+        setGameSeed(&worlds[w], config->seed);
+        initGame(&worlds[w]);
+    }
+    GameWorld_s* perTick = &worlds[0];
+    GameWorld_s* skipping = &worlds[1];
+
+    long long t = 0, segments = 0, gamesFinished = 0, skippedTicks = 0;
+    int diverged = 0;
+    while (t < config->ticks) {
+        // A entrada do trecho, igual nos dois mundos.
+        unsigned long long draw = checkDraw(config->seed, segments);
+        for (int w = 0; w < 2; w++) {
+            switch (draw % 4) {
+                case 0: playerJump(&worlds[w]); break;
+                case 1: playerSetDucking(&worlds[w], !worlds[w].player.ducking); break;
+                case 2: cycleSelectedTrash(&worlds[w]); spawnThrownTrashItem(&worlds[w]); break;
+                default: break; // Sem entrada: só o salto.
+            }
+        }
+        long long gap = 1 + (long long)((draw >> 8) % CHECK_SKIP_MAX_GAP);
+        if (gap > config->ticks - t) gap = config->ticks - t;
+
+        // step() não faz nada fora da partida, e skipTicks para quando ela acaba.
+        long long stepped = 0;
+        while (stepped < gap && perTick->gameState == PLAYING) {
+            step(perTick);
+            stepped++;
+        }
+        long long skipped = 0;
+        while (skipped < gap && skipping->gameState == PLAYING) {
+            long long done = skipTicks(skipping, gap - skipped);
+            if (done == 0) break;
+            skipped += done;
+        }
+        skippedTicks += skipped;
+        t += gap;
+        segments++;
+
+        if (!worldsMatch(perTick, skipping)) {
+            diverged = 1;
+            break;
+        }
+        if (perTick->gameState == GAME_OVER) {
+            gamesFinished++;
+            initGame(perTick);
+            initGame(skipping);
+        }
+    }
+
+    if (diverged) {
+        printf("Salto de passos DIVERGE no trecho %lld (passo %lld da execucao, passo %lld da partida)\n",
+               segments, t, perTick->simTick);
+        printf("  passo a passo: passo %lld, pontuacao %d, vidas %d, velocidade %.6f\n",
+               perTick->simTick, perTick->score, perTick->lives, perTick->currentObstacleSpeed);
+        printf("  com skipTicks: passo %lld, pontuacao %d, vidas %d, velocidade %.6f\n",
+               skipping->simTick, skipping->score, skipping->lives, skipping->currentObstacleSpeed);
+    } else {
+        printf("Salto de passos conferido: %lld passos (%lld simulados pelo salto), %lld trechos, %lld partidas encerradas, identicos\n",
+               t, skippedTicks, segments, gamesFinished);
+    }
+    freeWorld(perTick);
+    freeWorld(skipping);
+    return diverged;
+}
+
+int main(int argc, char** argv) {
+    // Valores padrão: um milhão de passos (~4,6 horas de jogo a 60 passos por segundo).
+    SimConfig_s config;
+    config.ticks = 1000000;
+    config.seed = 1;
+    config.skip = 0;
+    config.bot = 0;
+    config.planner = 0;
+    config.budgetSeconds = 0.002;
+    int worldCount = 1;
+    int threads = 0;
+    int checkEvents = 0;
+    int checkSkip = 0;
+
+    // Leitura simples dos argumentos da linha de comando.
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--ticks") == 0 && i + 1 < argc) {
+            config.ticks = atoll(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            config.seed = (unsigned int)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--skip") == 0) {
+            config.skip = 1;
+        } else if (strcmp(argv[i], "--bot") == 0) {
+            config.bot = 1;
+        } else if (strcmp(argv[i], "--planner") == 0) {
+            config.planner = 1;
+        } else if (strcmp(argv[i], "--budget-ms") == 0 && i + 1 < argc) {
+            config.budgetSeconds = atof(argv[++i]) / 1000.0;
+        } else if (strcmp(argv[i], "--worlds") == 0 && i + 1 < argc) {
+            worldCount = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--check-events") == 0) {
+            checkEvents = 1;
+        } else if (strcmp(argv[i], "--check-skip") == 0) {
+            checkSkip = 1;
+        } else {
+            fprintf(stderr, "Uso: %s [--ticks N] [--seed S] [--skip] [--bot] [--planner] [--budget-ms B] [--worlds W] [--threads T] [--check-events] [--check-skip]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (worldCount < 1) worldCount = 1;
+    if (checkEvents) return checkThrownTrashEvents(&config);
+    if (checkSkip) return checkSkipTicks(&config);
+
+    // Os mundos não compartilham estado; só o nível SIMD é global, então é escolhido antes das threads.
+    getSimdLevel();
+    ThreadPool_s* pool = threadPoolCreate(threads);
+    SimRun_s* runs = (SimRun_s*)calloc((size_t)worldCount, sizeof(SimRun_s));
+    SimBatch_s batch = {&config, runs};
+
+    printf("ecorunner-sim: %lld passos x %d mundo(s), semente %u, %d thread(s)%s\n", config.ticks, worldCount,
+           config.seed, threadPoolSize(pool),
+           config.planner ? " (planejador)" : config.bot ? " (jogador automatico)" : config.skip ? " (salto de passos sem eventos)" : "");
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    threadPoolRun(pool, worldCount, runWorld, &batch);
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    double seconds = elapsed.count();
+
+    // Soma as estatísticas de todos os mundos.
+    long long gamesFinished = 0;
+    int bestScore = 0;
+    float topSpeed = 0.0f;
+    CollisionStats_s collisions = {0, 0, 0, 0};
+    long long nodesExpanded = 0, plans = 0, truncatedPlans = 0;
+    double planningSeconds = 0.0;
+    for (int w = 0; w < worldCount; w++) {
+        gamesFinished += runs[w].gamesFinished;
+        if (runs[w].bestScore > bestScore) bestScore = runs[w].bestScore;
+        if (runs[w].topSpeed > topSpeed) topSpeed = runs[w].topSpeed;
+        if (runs[w].planner) {
+            nodesExpanded += runs[w].planner->nodesExpanded;
+            plans += runs[w].planner->plans;
+            truncatedPlans += runs[w].planner->truncatedPlans;
+            planningSeconds += runs[w].planner->planningSeconds;
+            plannerDestroy(runs[w].planner);
+        }
+        collisions.pairsTested += runs[w].world.collisionStats.pairsTested;
+        collisions.pairsHit += runs[w].world.collisionStats.pairsHit;
+        collisions.pairsPredicted += runs[w].world.collisionStats.pairsPredicted;
+        collisions.hitsPredicted += runs[w].world.collisionStats.hitsPredicted;
+        freeWorld(&runs[w].world);
+    }
+    double totalTicks = (double)config.ticks * worldCount;
+
+    printf("Partidas encerradas: %lld (melhor pontuacao: %d)\n", gamesFinished, bestScore);
+    printf("Tempo: %.3f s\n", seconds);
+    printf("Passos por segundo: %.0f\n", seconds > 0.0 ? totalTicks / seconds : 0.0);
+    printf("Colisoes do lixo: %lld pares testados, %lld acertos\n", collisions.pairsTested, collisions.pairsHit);
+    printf("Previsao do lixo: %lld pares percorridos, %lld acertos previstos\n", collisions.pairsPredicted, collisions.hitsPredicted);
+    printf("Velocidade maxima dos obstaculos: %.2f\n", topSpeed);
+    if (config.planner) {
+        printf("Planejador: %lld planos (%lld cortados pelo tempo), %lld estados simulados\n", plans, truncatedPlans, nodesExpanded);
+        printf("Planejador: %.0f estados por segundo, %.3f ms por plano\n",
+               planningSeconds > 0.0 ? nodesExpanded / planningSeconds : 0.0, plans > 0 ? planningSeconds * 1000.0 / plans : 0.0);
+    }
+
+    free(runs);
+    threadPoolDestroy(pool);
+    return 0;
+}
@@ -0,0 +1,339 @@
+// --- ecorunner-tune ---
+// Ajuste automático dos espaçamentos entre obstáculos e entre lixeiras (DifficultySettings_s).
+// Um otimizador sep-CMA-ES (estratégia evolutiva com adaptação da matriz de covariância diagonal)
+// propõe, a cada geração, vários conjuntos de espaçamentos; cada um é avaliado com milhares de
+// partidas sem janela jogadas pelo jogador automático (core/AutoPlayer.h), em todas as threads.
+// O bot sozinho quase nunca erra, então ele joga com "distrações" (AutoPlayerLapses_s): em média
+// 'lapse-rate' vezes por segundo ele para de reagir por 'lapse-seconds', e a curva passa a
+// depender dos espaçamentos.
+// O objetivo é uma curva de dificuldade: a fração de partidas ainda vivas em cada instante
+// (e, opcionalmente, a pontuação por minuto). O melhor conjunto é gravado como preset,
+// que a janela carrega ao iniciar (ver core/DifficultyPreset.h).
+//
+// Uso: ecorunner-tune [--target L] [--score-rate P] [--score-weight W] [--games N] [--generations G]
+//                     [--lapse-rate R] [--lapse-seconds D] [--seed S] [--threads T] [--out arquivo]
+//   --target:      pares segundos:fração_viva separados por vírgula (padrão 60:0.9,120:0.75,180:0.6).
+//   --score-rate:  pontos por minuto desejados (0 = ignorar, o padrão); --score-weight é o peso desse termo.
+//   --games:       partidas por candidato (padrão 1000). As sementes são as mesmas para todos os
+//                  candidatos, então as diferenças entre eles não vêm da sorte.
+//   --lapse-rate, --lapse-seconds: distrações do bot (padrão 0.5 por segundo, 1 s cada).
+//   --out:         arquivo do preset (padrão DIFFICULTY_PRESET_FILE).
+#include "Config.h"
+#include "World.h"
+#include "GameLogic.h"
+#include "AutoPlayer.h"
+#include "DifficultyPreset.h"
+#include "SimdKernels.h"
+#include "ThreadPool.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+
+#define TUNE_PARAMS 4        // Espaçamentos ajustados: mínimo e sorteado, de obstáculos e de lixeiras.
+#define TUNE_SCALE 1000.0    // O otimizador trabalha em milhares de pixels (valores perto de 1).
+#define TUNE_MAX_VALUE 1.5   // Limite de cada espaçamento (1500 px).
+#define MAX_TARGETS 16
+#define LAMBDA 8             // Candidatos por geração (4 + 3 ln n, com n = 4).
+#define MU (LAMBDA / 2)      // Candidatos usados na recombinação.
+
+// Resultado de uma partida.
+typedef struct {
+    long long survivalTicks;
+    int score;
+    int died;
+} TuneGame_s;
+
+typedef struct {
+    DifficultySettings_s candidates[LAMBDA];
+    int games;
+    long long maxTicks;
+    unsigned long long seed;
+    double lapseRate;      // Distrações do bot (ver AutoPlayerLapses_s).
+    double lapseSeconds;
+    TuneGame_s* results; // [candidato * games + partida]
+} TuneBatch_s;
+
+// Ponto da curva de dificuldade: fração de partidas ainda vivas em 'seconds'.
+typedef struct {
+    double seconds;
+    double alive;
+} TargetPoint_s;
+
+/**
+ * Joga a partida 'index' (candidato index / games). Executada pelas threads do pool.
+ */
+static void playGame(void* context, int index) {
+    TuneBatch_s* batch = (TuneBatch_s*)context;
+    int candidate = index / batch->games, game = index % batch->games;
+    TuneGame_s* result = &batch->results[index];
+
+    GameWorld_s world;
+    initWorld(&world);
+    world.logMessages = 0;
+    world.difficulty = batch->candidates[candidate];
+    setGameSeed(&world, batch->seed + (unsigned long long)game);
+    initGame(&world);
+    // As distrações da partida g caem nos mesmos passos para todos os candidatos.
+    AutoPlayerLapses_s lapses;
+    autoPlayerLapsesInit(&lapses, batch->lapseRate, batch->lapseSeconds, batch->seed + (unsigned long long)game);
+    while (world.gameState == PLAYING && world.simTick < batch->maxTicks) {
+        autoPlayerActWithLapses(&world, &lapses);
+        step(&world);
+    }
+    result->survivalTicks = world.simTick;
+    result->score = world.score;
+    result->died = world.gameState == GAME_OVER;
+    freeWorld(&world);
+}
+
+// --- Parâmetros <-> espaçamentos ---
+static double clampParam(double value, double minimum) {
+    return value < minimum ? minimum : value > TUNE_MAX_VALUE ? TUNE_MAX_VALUE : value;
+}
+
+static DifficultySettings_s settingsFrom(const double* x) {
+    DifficultySettings_s settings;
+    settings.speedRamp = OBSTACLE_SPEED_RAMP;
+    // Os mínimos não descem do espaçamento jogável; os sorteados podem chegar a 0.
+    settings.minObstacleSpacing = (int)(clampParam(x[0], MIN_PLAYABLE_SPACING / TUNE_SCALE) * TUNE_SCALE + 0.5);
+    settings.randObstacleSpacing = (int)(clampParam(x[1], 0.0) * TUNE_SCALE + 0.5);
+    settings.minTrashBinSpacing = (int)(clampParam(x[2], MIN_PLAYABLE_SPACING / TUNE_SCALE) * TUNE_SCALE + 0.5);
+    settings.randTrashBinSpacing = (int)(clampParam(x[3], 0.0) * TUNE_SCALE + 0.5);
+    return settings;
+}
+
+// --- Gerador normal (Box-Muller sobre xorshift64), só para as amostras do otimizador ---
+static unsigned long long rngState;
+
+static double uniform01() {
+    rngState ^= rngState << 13; rngState ^= rngState >> 7; rngState ^= rngState << 17;
+    return ((rngState >> 11) + 0.5) * (1.0 / 9007199254740992.0);
+}
+
+static double gaussian() {
+    return sqrt(-2.0 * log(uniform01())) * cos(6.283185307179586 * uniform01());
+}
+
+/**
+ * Erro do candidato em relação à curva: soma dos quadrados das diferenças da fração viva
+ * em cada ponto, mais o erro relativo da pontuação por minuto (se pedido).
+ */
+static double loss(const TuneGame_s* games, int count, const TargetPoint_s* targets, int targetCount,
+                   double scoreRate, double scoreWeight, double* aliveOut) {
+    double error = 0.0;
+    for (int t = 0; t < targetCount; t++) {
+        long long tick = (long long)(targets[t].seconds / SIM_TICK_SECONDS);
+        int alive = 0;
+        for (int g = 0; g < count; g++) alive += !games[g].died || games[g].survivalTicks >= tick;
+        double fraction = (double)alive / count;
+        if (aliveOut) aliveOut[t] = fraction;
+        error += (fraction - targets[t].alive) * (fraction - targets[t].alive);
+    }
+    if (scoreRate > 0.0) {
+        double points = 0.0, minutes = 0.0;
+        for (int g = 0; g < count; g++) {
+            points += games[g].score;
+            minutes += games[g].survivalTicks * SIM_TICK_SECONDS / 60.0;
+        }
+        double rate = minutes > 0.0 ? points / minutes : 0.0;
+        error += scoreWeight * ((rate - scoreRate) / scoreRate) * ((rate - scoreRate) / scoreRate);
+    }
+    return error;
+}
+
+static int parseTargets(const char* text, TargetPoint_s* targets) {
+    int count = 0;
+    while (*text && count < MAX_TARGETS) {
+        char* end;
+        targets[count].seconds = strtod(text, &end);
+        if (end == text || *end != ':') return -1;
+        text = end + 1;
+        targets[count].alive = strtod(text, &end);
+        if (end == text) return -1;
+        count++;
+        text = (*end == ',') ? end + 1 : end;
+    }
+    return count;
+}
+
+int main(int argc, char** argv) {
+    TargetPoint_s targets[MAX_TARGETS];
+    int targetCount = parseTargets("60:0.9,120:0.75,180:0.6", targets);
+    double scoreRate = 0.0, scoreWeight = 0.1;
+    double lapseRate = AUTOPLAYER_LAPSE_RATE, lapseSeconds = AUTOPLAYER_LAPSE_SECONDS;
+    int games = 1000, generations = 20, threads = 0;
+    unsigned long long seed = 1;
+    const char* outPath = DIFFICULTY_PRESET_FILE;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--target") == 0 && i + 1 < argc) {
+            targetCount = parseTargets(argv[++i], targets);
+        } else if (strcmp(argv[i], "--score-rate") == 0 && i + 1 < argc) {
+            scoreRate = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--score-weight") == 0 && i + 1 < argc) {
+            scoreWeight = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--lapse-rate") == 0 && i + 1 < argc) {
+            lapseRate = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--lapse-seconds") == 0 && i + 1 < argc) {
+            lapseSeconds = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--games") == 0 && i + 1 < argc) {
+            games = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--generations") == 0 && i + 1 < argc) {
+            generations = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+            outPath = argv[++i];
+        } else {
+            fprintf(stderr, "Uso: %s [--target L] [--score-rate P] [--score-weight W] [--games N] [--generations G]\n"
+                            "          [--lapse-rate R] [--lapse-seconds D] [--seed S] [--threads T] [--out arquivo]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (targetCount <= 0 || games < 1 || generations < 1) {
+        fprintf(stderr, "Curva alvo invalida ou numero de partidas/geracoes menor que 1.\n");
+        return 1;
+    }
+
+    // As partidas só precisam ir até o último ponto da curva.
+    long long maxTicks = 0;
+    for (int t = 0; t < targetCount; t++) {
+        long long tick = (long long)(targets[t].seconds / SIM_TICK_SECONDS) + 1;
+        if (tick > maxTicks) maxTicks = tick;
+    }
+
+    // --- Constantes do sep-CMA-ES (Ros e Hansen, 2008) ---
+    const int n = TUNE_PARAMS;
+    double weights[MU], weightSum = 0.0, weightSquares = 0.0;
+    for (int i = 0; i < MU; i++) {
+        weights[i] = log(MU + 0.5) - log(i + 1.0);
+        weightSum += weights[i];
+    }
+    for (int i = 0; i < MU; i++) {
+        weights[i] /= weightSum;
+        weightSquares += weights[i] * weights[i];
+    }
+    double muEff = 1.0 / weightSquares;
+    double cSigma = (muEff + 2.0) / (n + muEff + 5.0);
+    double dSigma = 1.0 + 2.0 * fmax(0.0, sqrt((muEff - 1.0) / (n + 1.0)) - 1.0) + cSigma;
+    double cc = (4.0 + muEff / n) / (n + 4.0 + 2.0 * muEff / n);
+    double c1 = 2.0 / ((n + 1.3) * (n + 1.3) + muEff);
+    double cMu = fmin(1.0 - c1, 2.0 * (muEff - 2.0 + 1.0 / muEff) / ((n + 2.0) * (n + 2.0) + muEff));
+    c1 *= (n + 2.0) / 3.0;  // Covariância diagonal: aprende mais rápido.
+    cMu *= (n + 2.0) / 3.0;
+    if (c1 + cMu > 1.0) cMu = 1.0 - c1;
+    double expectedNorm = sqrt((double)n) * (1.0 - 1.0 / (4.0 * n) + 1.0 / (21.0 * n * n));
+
+    // --- Estado: começa nos valores atuais de Config.h ---
+    double mean[TUNE_PARAMS] = {MIN_OBSTACLE_SPACING / TUNE_SCALE, RAND_OBSTACLE_SPACING / TUNE_SCALE,
+                                MIN_TRASHBIN_SPACING / TUNE_SCALE, RAND_TRASHBIN_SPACING / TUNE_SCALE};
+    double variance[TUNE_PARAMS] = {1.0, 1.0, 1.0, 1.0}; // Diagonal da covariância.
+    double pathSigma[TUNE_PARAMS] = {0}, pathC[TUNE_PARAMS] = {0};
+    double sigma = 0.15;
+    double z[LAMBDA][TUNE_PARAMS], x[LAMBDA][TUNE_PARAMS], losses[LAMBDA];
+    int order[LAMBDA];
+    rngState = seed * 0x9E3779B97F4A7C15ull + 1;
+
+    TuneBatch_s batch;
+    batch.games = games;
+    batch.maxTicks = maxTicks;
+    batch.seed = seed;
+    batch.lapseRate = lapseRate;
+    batch.lapseSeconds = lapseSeconds;
+    batch.results = (TuneGame_s*)malloc(sizeof(TuneGame_s) * (size_t)LAMBDA * games);
+
+    DifficultySettings_s best;
+    double bestLoss = 1e300;
+    double bestAlive[MAX_TARGETS];
+
+    // Os mundos não compartilham estado; só o nível SIMD é global, então é escolhido antes das threads.
+    getSimdLevel();
+    ThreadPool_s* pool = threadPoolCreate(threads);
+    printf("ecorunner-tune: %d geracoes x %d candidatos x %d partidas (ate %lld passos), %d thread(s)\n",
+           generations, LAMBDA, games, maxTicks, threadPoolSize(pool));
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    for (int generation = 0; generation < generations; generation++) {
+        // Amostra os candidatos: x = média + sigma * sqrt(C) * z.
+        for (int k = 0; k < LAMBDA; k++) {
+            for (int j = 0; j < n; j++) {
+                z[k][j] = gaussian();
+                x[k][j] = mean[j] + sigma * sqrt(variance[j]) * z[k][j];
+            }
+            batch.candidates[k] = settingsFrom(x[k]);
+        }
+
+        // Todas as partidas de todos os candidatos em um único laço paralelo.
+        threadPoolRun(pool, LAMBDA * games, playGame, &batch);
+
+        for (int k = 0; k < LAMBDA; k++) {
+            double alive[MAX_TARGETS];
+            losses[k] = loss(&batch.results[(size_t)k * games], games, targets, targetCount, scoreRate, scoreWeight, alive);
+            if (losses[k] < bestLoss) {
+                bestLoss = losses[k];
+                best = batch.candidates[k];
+                memcpy(bestAlive, alive, sizeof(double) * targetCount);
+            }
+            // Ordenação por inserção (poucos candidatos).
+            int i = k;
+            while (i > 0 && losses[order[i - 1]] > losses[k]) { order[i] = order[i - 1]; i--; }
+            order[i] = k;
+        }
+
+        // --- Atualização ---
+        double zMean[TUNE_PARAMS] = {0}, yMean[TUNE_PARAMS] = {0};
+        for (int i = 0; i < MU; i++) {
+            for (int j = 0; j < n; j++) {
+                zMean[j] += weights[i] * z[order[i]][j];
+                yMean[j] += weights[i] * sqrt(variance[j]) * z[order[i]][j];
+            }
+        }
+        double norm = 0.0;
+        for (int j = 0; j < n; j++) {
+            mean[j] += sigma * yMean[j];
+            pathSigma[j] = (1.0 - cSigma) * pathSigma[j] + sqrt(cSigma * (2.0 - cSigma) * muEff) * zMean[j];
+            norm += pathSigma[j] * pathSigma[j];
+        }
+        norm = sqrt(norm);
+        int hSigma = norm / sqrt(1.0 - pow(1.0 - cSigma, 2.0 * (generation + 1))) < (1.4 + 2.0 / (n + 1.0)) * expectedNorm;
+        for (int j = 0; j < n; j++) {
+            pathC[j] = (1.0 - cc) * pathC[j] + hSigma * sqrt(cc * (2.0 - cc) * muEff) * yMean[j];
+            double rankMu = 0.0;
+            for (int i = 0; i < MU; i++) {
+                double y = sqrt(variance[j]) * z[order[i]][j];
+                rankMu += weights[i] * y * y;
+            }
+            variance[j] = (1.0 - c1 - cMu) * variance[j]
+                        + c1 * (pathC[j] * pathC[j] + (1 - hSigma) * cc * (2.0 - cc) * variance[j])
+                        + cMu * rankMu;
+        }
+        sigma *= exp((cSigma / dSigma) * (norm / expectedNorm - 1.0));
+
+        DifficultySettings_s m = settingsFrom(mean);
+        printf("geracao %2d: melhor erro %.5f | media: obstaculos %d+%d, lixeiras %d+%d | sigma %.4f\n",
+               generation + 1, losses[order[0]], m.minObstacleSpacing, m.randObstacleSpacing,
+               m.minTrashBinSpacing, m.randTrashBinSpacing, sigma);
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    printf("Tempo: %.1f s\n", elapsed.count());
+    printf("Melhor: obstaculos %d+%d, lixeiras %d+%d (erro %.5f)\n", best.minObstacleSpacing, best.randObstacleSpacing,
+           best.minTrashBinSpacing, best.randTrashBinSpacing, bestLoss);
+    for (int t = 0; t < targetCount; t++) {
+        printf("  vivos aos %.0f s: %.3f (alvo %.3f)\n", targets[t].seconds, bestAlive[t], targets[t].alive);
+    }
+
+    char comment[128];
+    snprintf(comment, sizeof(comment), "gerado por ecorunner-tune (%d partidas por candidato, erro %.5f)", games, bestLoss);
+    int saved = saveDifficultyPreset(outPath, &best, comment);
+    if (saved) printf("Preset gravado em %s\n", outPath);
+    else fprintf(stderr, "Nao foi possivel gravar %s\n", outPath);
+
+    free(batch.results);
+    threadPoolDestroy(pool);
+    return saved ? 0 : 1;
+}